@@ -2,10 +2,36 @@
 #define SEQUENCE_H
 
 #include <stdexcept>
+#include <iterator>
+#include <cstddef>
 
 template <class T> class Sequence
     {
         public:
+            // Общий итератор по индексам через виртуальный Get. Наследники с известным
+            // хранилищем (ArraySequence, ListSequence) прячут begin()/end() своими, более быстрыми
+            class ConstIterator
+                {
+                    public:
+                        typedef std::input_iterator_tag iterator_category;
+                        typedef T value_type;
+                        typedef std::ptrdiff_t difference_type;
+                        typedef const T* pointer;
+                        typedef T reference;
+
+                        ConstIterator(const Sequence<T>* sequence, int index) : sequence(sequence), index(index) {}
+
+                        T operator*() const { return sequence->Get(index); }
+                        ConstIterator& operator++() { ++index; return *this; }
+                        ConstIterator operator++(int) { ConstIterator old = *this; ++index; return old; }
+                        bool operator==(const ConstIterator& other) const { return index == other.index && sequence == other.sequence; }
+                        bool operator!=(const ConstIterator& other) const { return !(*this == other); }
+
+                    private:
+                        const Sequence<T>* sequence;
+                        int index;
+                };
+
             virtual ~Sequence() = default;
 
             virtual T GetFirst() const = 0;
@@ -19,6 +45,9 @@ template <class T> class Sequence
             virtual Sequence<T>* InsertAt(T item, int index) = 0;
             virtual Sequence<T>* Concat(Sequence<T>* list) = 0;
             virtual std::string ToString() const = 0;
+
+            ConstIterator begin() const { return ConstIterator(this, 0); }
+            ConstIterator end() const { return ConstIterator(this, GetLength()); }
     };
 
-#endif 
\ No newline at end of file
+#endif
\ No newline at end of file
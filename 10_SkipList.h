@@ -7,6 +7,7 @@
 #include <limits>
 #include <vector>
 #include <stdexcept>
+#include "19_MemoryResource.h"
 
 template <typename T>
 class SkipList {
@@ -24,6 +25,7 @@ private:
     int maxLevel;
     float probability;
     size_t size;
+    MemoryResource* resource;
 
 public:
     
@@ -69,7 +71,7 @@ public:
     }
 };
 
-    explicit SkipList(int maxLvl = 16, float p = 0.5);
+    explicit SkipList(int maxLvl = 16, float p = 0.5, MemoryResource* resource = DefaultResource());
     ~SkipList();
 
     bool contains(const T& key) const;
@@ -91,19 +93,20 @@ private:
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 template <typename T>
-SkipList<T>::SkipList(int maxLvl, float p) 
+SkipList<T>::SkipList(int maxLvl, float p, MemoryResource* resource) 
     : maxLevel(maxLvl > 0 ? maxLvl : 16), 
       probability(p > 0 && p < 1 ? p : 0.5),
       head(nullptr),
-      size(0) {
+      size(0),
+      resource(resource) {
     
     if (maxLvl <= 0) throw std::invalid_argument("Max level must be positive");
     if (p <= 0 || p >= 1) throw std::invalid_argument("Probability must be between 0 and 1");
 
     Node* prevHead = nullptr;
     for (int i = 0; i < maxLevel; ++i) {
-        Node* newTail = new Node(std::numeric_limits<T>::max());
-        head = new Node(std::numeric_limits<T>::min(), newTail, prevHead);
+        Node* newTail = NewObject<Node>(resource, std::numeric_limits<T>::max());
+        head = NewObject<Node>(resource, std::numeric_limits<T>::min(), newTail, prevHead);
         prevHead = head;
     }
     srand(static_cast<unsigned>(time(nullptr)));
@@ -152,7 +155,7 @@ void SkipList<T>::insert(const T& key) {
     Node* downNode = nullptr;
     
     for (int i = 0; i < levels; ++i) {
-        Node* newNode = new Node(key, predecessors[i]->next, downNode);
+        Node* newNode = NewObject<Node>(resource, key, predecessors[i]->next, downNode);
         predecessors[i]->next = newNode;
         downNode = newNode;
     }
@@ -182,7 +185,7 @@ void SkipList<T>::remove(const T& key) {
         }
         
         prev->next = current->next;
-        delete current;
+        DeleteObject(resource, current);
         current = nextDown;
         currentLevel++;
     }
@@ -196,8 +199,8 @@ void SkipList<T>::remove(const T& key) {
         
         // Удаляем хвостовой узел уровня
         Node* tail = oldHead->next;
-        delete tail;
-        delete oldHead;
+        DeleteObject(resource, tail);
+        DeleteObject(resource, oldHead);
         
         maxLevel--;
     }
@@ -241,7 +244,7 @@ void SkipList<T>::clear() {
         while (currentNode) {
             Node* temp = currentNode;
             currentNode = currentNode->next;
-            delete temp;
+            DeleteObject(resource, temp);
         }
     }
     
@@ -1,6 +1,7 @@
 #include <cassert>
 #include <iostream>
 #include <fstream>
+#include <vector>
 #include "5_LinearForm.h"
 
 void TestConstructors() {
@@ -35,28 +36,30 @@ void TestOperations() {
     LinearForm<int> lf2(arr2, 3);
 
     // Тест сложения
-    auto sum = lf1 + lf2;
-    assert(sum->GetLength() == 3);
-    assert(sum->Get(0) == 5);
-    assert(sum->Get(1) == 7);
-    assert(sum->Get(2) == 9);
-    delete sum;
+    LinearForm<int> sum = lf1 + lf2;
+    assert(sum.GetLength() == 3);
+    assert(sum.Get(0) == 5);
+    assert(sum.Get(1) == 7);
+    assert(sum.Get(2) == 9);
 
     // Тест вычитания
-    auto diff = lf2 - lf1;
-    assert(diff->GetLength() == 3);
-    assert(diff->Get(0) == 3);
-    assert(diff->Get(1) == 3);
-    assert(diff->Get(2) == 3);
-    delete diff;
+    LinearForm<int> diff = lf2 - lf1;
+    assert(diff.GetLength() == 3);
+    assert(diff.Get(0) == 3);
+    assert(diff.Get(1) == 3);
+    assert(diff.Get(2) == 3);
 
     // Тест умножения на скаляр
-    auto mult = lf1 * 2;
-    assert(mult->GetLength() == 3);
-    assert(mult->Get(0) == 2);
-    assert(mult->Get(1) == 4);
-    assert(mult->Get(2) == 6);
-    delete mult;
+    LinearForm<int> mult = lf1 * 2;
+    assert(mult.GetLength() == 3);
+    assert(mult.Get(0) == 2);
+    assert(mult.Get(1) == 4);
+    assert(mult.Get(2) == 6);
+
+    // Методы по-прежнему возвращают новую форму в куче
+    LinearForm<int>* added = lf1.Add(lf2);
+    assert(added->Get(2) == 9);
+    delete added;
     
     std::cout << "Passed!\n";
 }
@@ -113,6 +116,226 @@ void TestEdgeCases() {
     std::cout << "Passed!\n";
 }
 
+// Векторные ядра против скалярного цикла на длинах с хвостами любой длины
+template <class T> void CheckKernels(T scalar) {
+    for (int n = 0; n <= 37; ++n) {
+        std::vector<T> a(n + 1), b(n + 1), out(n + 1), expected(n + 1);
+        for (int i = 0; i < n; ++i) {
+            a[i] = static_cast<T>(i * 3 - 7);
+            b[i] = static_cast<T>(50 - i);
+        }
+        SimdKernels<T>::Add(a.data(), b.data(), out.data(), n);
+        ScalarKernels<T>::Add(a.data(), b.data(), expected.data(), n);
+        assert(out == expected);
+        SimdKernels<T>::Sub(a.data(), b.data(), out.data(), n);
+        ScalarKernels<T>::Sub(a.data(), b.data(), expected.data(), n);
+        assert(out == expected);
+        SimdKernels<T>::Scale(a.data(), scalar, out.data(), n);
+        ScalarKernels<T>::Scale(a.data(), scalar, expected.data(), n);
+        assert(out == expected);
+        // Результат поверх аргумента
+        SimdKernels<T>::Add(a.data(), a.data(), a.data(), n);
+        ScalarKernels<T>::Add(b.data(), b.data(), b.data(), n);
+        for (int i = 0; i < n; ++i) {
+            assert(a[i] == static_cast<T>(2 * (i * 3 - 7)) && b[i] == static_cast<T>(2 * (50 - i)));
+        }
+    }
+}
+
+void TestKernels() {
+    std::cout << "Running TestKernels... ";
+
+    CheckKernels<int>(-3);
+    CheckKernels<float>(0.5f);
+    CheckKernels<double>(-1.25);
+    CheckKernels<long>(7);
+
+    std::vector<double> big(1001);
+    for (int i = 0; i < 1001; ++i) {
+        big[i] = i * 0.25;
+    }
+    LinearForm<double> lf(big.data(), 1001);
+    LinearForm<double>* doubled = lf.Multiply(2.0);
+    LinearForm<double>* zero = doubled->Subtract(lf);
+    LinearForm<double>* back = zero->Add(lf);
+    assert(doubled->Get(1000) == 500.0 && zero->Get(999) == lf.Get(999) && back->Get(3) == 1.5);
+    delete doubled;
+    delete zero;
+    delete back;
+
+    std::cout << "Passed!\n";
+}
+
+// Пакетное вычисление против поточечного Evaluate: обе раскладки, несколько форм,
+// размерности с хвостами и разбиение по потокам
+void TestBatchEvaluation() {
+    std::cout << "Running TestBatchEvaluation... ";
+
+    const int dim = 300;
+    const int count = 9000;
+    std::vector<double> rows(count * dim), columns(count * dim);
+    for (int p = 0; p < count; ++p) {
+        for (int j = 0; j < dim; ++j) {
+            double x = (p * 7 + j * 3) % 11 - 5;
+            rows[p * dim + j] = x;
+            columns[j * count + p] = x;
+        }
+    }
+    std::vector<LinearForm<double>> forms;
+    for (int f = 0; f < 3; ++f) {
+        std::vector<double> coefficients(dim + 1);
+        for (int i = 0; i <= dim; ++i) {
+            coefficients[i] = (i + f) % 5 - 2;
+        }
+        forms.push_back(LinearForm<double>(coefficients.data(), dim + 1));
+    }
+
+    for (int threads = 1; threads <= 2; ++threads) {
+        ArraySequence<double>* byRows = forms[1].EvaluateBatch(rows.data(), count, ROW_MAJOR, threads);
+        ArraySequence<double>* byColumns = forms[1].EvaluateBatch(columns.data(), count, COLUMN_MAJOR, threads);
+        ArraySequence<double>* allRows = LinearForm<double>::EvaluateBatch(forms.data(), 3, rows.data(), count, ROW_MAJOR, threads);
+        ArraySequence<double>* allColumns = LinearForm<double>::EvaluateBatch(forms.data(), 3, columns.data(), count, COLUMN_MAJOR, threads);
+        assert(byRows->GetLength() == count && allColumns->GetLength() == count * 3);
+        for (int p = 0; p < count; p += 97) {
+            MutableArraySequence<double> point(rows.data() + p * dim, dim);
+            assert(byRows->Get(p) == forms[1].Evaluate(point));
+            assert(byColumns->Get(p) == byRows->Get(p));
+            for (int f = 0; f < 3; ++f) {
+                double expected = forms[f].Evaluate(point);
+                assert(allRows->Get(p * 3 + f) == expected && allColumns->Get(p * 3 + f) == expected);
+            }
+        }
+        delete byRows;
+        delete byColumns;
+        delete allRows;
+        delete allColumns;
+    }
+
+    // Форма из одного свободного члена: точки нулевой размерности
+    int constant[] = {4};
+    LinearForm<int> lf(constant, 1);
+    ArraySequence<int>* values = lf.EvaluateBatch(nullptr, 5, ROW_MAJOR);
+    assert(values->GetLength() == 5 && values->Get(4) == 4);
+    delete values;
+
+    bool exceptionThrown = false;
+    try {
+        int other[] = {1, 2};
+        LinearForm<int> pair[] = { lf, LinearForm<int>(other, 2) };
+        LinearForm<int>::EvaluateBatch(pair, 2, constant, 1, ROW_MAJOR);
+    } catch (const std::invalid_argument&) {
+        exceptionThrown = true;
+    }
+    assert(exceptionThrown);
+
+    std::cout << "Passed!\n";
+}
+
+// Горнер, Эстрин и векторный Горнер против прямой суммы степеней. Коэффициенты и точки
+// подобраны так, что все промежуточные значения точны и порядок сложений не важен
+template <class T> void CheckPolynomial(int maxLength) {
+    T xs[] = {T(0), T(1), T(-1), T(2), T(-2), T(1), T(2), T(-1), T(0), T(-2), T(2), T(1), T(-1), T(2), T(0), T(-2), T(1), T(-1), T(2)};
+    const int count = sizeof(xs) / sizeof(xs[0]);
+    for (int length = 1; length <= maxLength; ++length) {
+        std::vector<T> coefficients(length);
+        for (int i = 0; i < length; ++i) {
+            coefficients[i] = static_cast<T>(i % 5 - 2);
+        }
+        LinearForm<T> lf(coefficients.data(), length);
+        ArraySequence<T>* many = lf.EvaluateMany(xs, count);
+        for (int p = 0; p < count; ++p) {
+            T expected = T(0);
+            T power = T(1);
+            for (int i = 0; i < length; ++i) {
+                expected += coefficients[i] * power;
+                power *= xs[p];
+            }
+            assert(lf.Evaluate(xs[p]) == expected);
+            assert(lf.EvaluateEstrin(xs[p]) == expected);
+            assert(many->Get(p) == expected);
+        }
+        delete many;
+    }
+}
+
+void TestPolynomialEvaluation() {
+    std::cout << "Running TestPolynomialEvaluation... ";
+
+    CheckPolynomial<int>(20);
+    CheckPolynomial<float>(20);
+    CheckPolynomial<double>(40);
+
+    double arr[] = {1.0, -3.0, 0.5};
+    LinearForm<double> lf(arr, 3);
+    assert(lf.Evaluate(0.5) == 1.0 - 1.5 + 0.125);
+    assert(lf.EvaluateEstrin(0.5) == 1.0 - 1.5 + 0.125);
+
+    LinearForm<double> empty;
+    bool exceptionThrown = false;
+    try {
+        empty.EvaluateEstrin(1.0);
+    } catch (const std::out_of_range&) {
+        exceptionThrown = true;
+    }
+    assert(exceptionThrown);
+
+    std::cout << "Passed!\n";
+}
+
+// Цепочки операторов: один проход, результат совпадает с пошаговыми методами
+void TestExpressions() {
+    std::cout << "Running TestExpressions... ";
+
+    double a_items[] = {1.0, 2.0, 3.0, 4.0};
+    double b_items[] = {0.5, -1.0, 2.0, 8.0};
+    double c_items[] = {4.0, 4.0, -4.0, 0.0};
+    LinearForm<double> a(a_items, 4), b(b_items, 4), c(c_items, 4);
+
+    LinearForm<double> result = a + b * 2 - c;
+    for (int i = 0; i < 4; ++i) {
+        assert(result.Get(i) == a_items[i] + b_items[i] * 2 - c_items[i]);
+    }
+
+    LinearForm<double> scaled = 0.5 * (a - b) / 2;
+    assert(scaled.Get(0) == 0.125 && scaled.Get(3) == -1.0);
+
+    // Выражение, в котором участвует сама форма
+    LinearForm<double> acc(a);
+    acc = acc + acc * 3;
+    assert(acc.Get(0) == 4.0 && acc.Get(3) == 16.0);
+    acc = b;
+    acc = (acc - b) * 10;
+    assert(acc.GetLength() == 4 && acc.Get(2) == 0.0);
+
+    // Форма длиннее встроенного буфера
+    std::vector<int> items(100);
+    for (int i = 0; i < 100; ++i) {
+        items[i] = i;
+    }
+    LinearForm<int> big(items.data(), 100);
+    LinearForm<int> tripled = big + big + big;
+    assert(tripled.GetLength() == 100 && tripled.Get(99) == 297);
+
+    bool exceptionThrown = false;
+    try {
+        LinearForm<double> shorter(a_items, 3);
+        LinearForm<double> bad = a + shorter;
+    } catch (const std::invalid_argument&) {
+        exceptionThrown = true;
+    }
+    assert(exceptionThrown);
+
+    exceptionThrown = false;
+    try {
+        LinearForm<double> bad = (a + b) / 0.0;
+    } catch (const std::invalid_argument&) {
+        exceptionThrown = true;
+    }
+    assert(exceptionThrown);
+
+    std::cout << "Passed!\n";
+}
+
 void RunFileTests() {
     std::cout << "Running FileTests... ";
     std::ofstream out("outputLin.txt");
@@ -136,18 +359,14 @@ void RunFileTests() {
         LinearForm<int> lf1(arr1, 3);
         LinearForm<int> lf2(arr2, 3);
         
-        auto sum = lf1 + lf2;
-        auto diff = lf2 - lf1;
-        auto mult = lf1 * 2;
+        LinearForm<int> sum = lf1 + lf2;
+        LinearForm<int> diff = lf2 - lf1;
+        LinearForm<int> mult = lf1 * 2;
         
         out << "Test 2: Math operations\n";
-        out << "Sum: " << sum->ToString() << "\n";
-        out << "Difference: " << diff->ToString() << "\n";
-        out << "Multiplication: " << mult->ToString() << "\n\n";
-        
-        delete sum;
-        delete diff;
-        delete mult;
+        out << "Sum: " << sum.ToString() << "\n";
+        out << "Difference: " << diff.ToString() << "\n";
+        out << "Multiplication: " << mult.ToString() << "\n\n";
     }
     
     // Тест 3: Вычисление значений
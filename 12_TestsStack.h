@@ -6,6 +6,7 @@
 #include <stdexcept>
 #include <ctime>
 #include <memory>
+#include <cassert>
 
 void testStack() {
     // Открываем файл для записи результатов тестов
@@ -98,6 +99,107 @@ void testStack() {
             std::cout << "Exception caught (Invalid index): " << e.what() << std::endl;
         }
 
+        // Тест 6: Pop до дна, пачки и независимость копий
+        std::cout << "\n=== Test 6: Pop to empty and bulk operations ===" << std::endl;
+        Stack<int> single;
+        single.Push(7);
+        assert(single.Pop() == 7 && single.IsEmpty());
+
+        int bulk[] = {1, 2, 3, 4, 5, 6};
+        Stack<int> stack6;
+        stack6.Reserve(6);
+        stack6.PushMany(bulk, 6);
+        Stack<int> snapshot(stack6);
+        int popped[3];
+        stack6.PopMany(3, popped);
+        assert(popped[0] == 6 && popped[1] == 5 && popped[2] == 4);
+        assert(stack6.GetLength() == 3 && stack6.Peek() == 3);
+        assert(snapshot.GetLength() == 6 && snapshot.Peek() == 6);
+        stack6.PopMany(3);
+        assert(stack6.IsEmpty());
+        std::cout << "Snapshot after popping the original: ";
+        snapshot.Print();
+
+        bool thrown = false;
+        try {
+            snapshot.PopMany(7);
+        } catch (const std::out_of_range& e) {
+            thrown = true;
+            std::cout << "Exception caught (PopMany past bottom): " << e.what() << std::endl;
+        }
+        assert(thrown && snapshot.GetLength() == 6);
+
+        // Тест 7: ленивая цепочка - тот же результат, что у Map/Where/Reduce по шагам
+        std::cout << "\n=== Test 7: Fused pipeline ===" << std::endl;
+        int values7[] = {1, 2, 3, 4, 5, 6, 7, 8};
+        Stack<int> stack7(values7, 8);
+        int offset = 10;
+        auto shifted = [offset](int x) { return x + offset; };
+        auto odd = [](int x) { return x % 2 != 0; };
+
+        Stack<int>* mapped7 = stack7.Map(shifted);
+        Stack<int>* filtered7 = mapped7->Where(odd);
+        int stepwise = filtered7->Reduce(sum, 0);
+        int fused = stack7.Pipeline().Map(shifted).Where(odd).Reduce(sum, 0);
+        assert(fused == stepwise && fused == 11 + 13 + 15 + 17);
+        assert(stack7.Pipeline().Map(shifted).Where(odd).Count() == filtered7->GetLength());
+        assert(stack7.Pipeline().Map(shifted).Count() == 8);
+
+        Stack<int>* fusedStack = stack7.Pipeline().Map(shifted).Where(odd).ToStack();
+        assert(fusedStack->GetLength() == 4 && fusedStack->Peek() == 17);
+        std::cout << "Fused Map(+10) / Where(odd): ";
+        fusedStack->Print();
+        delete fusedStack;
+        delete filtered7;
+        delete mapped7;
+
+        // Map может менять тип, Reduce - накапливать в другой тип
+        Stack<double>* halves = stack7.Pipeline().Map([](int x) { return x / 2.0; }).ToStack();
+        assert(halves->GetLength() == 8 && halves->Peek() == 4.0);
+        delete halves;
+        std::string digits = stack7.Pipeline().Where(odd).Reduce(
+            [](int x, const std::string& acc) { return acc + std::to_string(x); }, std::string());
+        assert(digits == "1357");
+
+        // Тест 8: параллельные варианты - те же результаты при любом размере куска
+        std::cout << "\n=== Test 8: Parallel Map / Where / Reduce ===" << std::endl;
+        Stack<int> stack8;
+        for (int i = 0; i < 5000; ++i) {
+            stack8.Push((i * 37) % 1001);
+        }
+        Stack<int>* sequentialMapped = stack8.Map(shifted);
+        Stack<int>* sequentialFiltered = stack8.Where(odd);
+        int grains[] = {1, 7, 1000, 5000, 100000};
+        for (int grain : grains) {
+            Stack<int> expectedMapped(*sequentialMapped);
+            Stack<int> expectedFiltered(*sequentialFiltered);
+            Stack<int>* parallelMapped = stack8.ParallelMap(shifted, grain, 4);
+            Stack<int>* parallelFiltered = stack8.ParallelWhere(odd, grain, 3);
+            assert(parallelMapped->GetLength() == 5000);
+            assert(parallelFiltered->GetLength() == expectedFiltered.GetLength());
+            while (!parallelMapped->IsEmpty()) {
+                assert(parallelMapped->Pop() == expectedMapped.Pop());
+            }
+            while (!parallelFiltered->IsEmpty()) {
+                assert(parallelFiltered->Pop() == expectedFiltered.Pop());
+            }
+            assert(stack8.ParallelReduce(sum, 5, grain, 4) == stack8.Reduce(sum, 5));
+            delete parallelFiltered;
+            delete parallelMapped;
+        }
+        delete sequentialFiltered;
+        delete sequentialMapped;
+
+        // Порядок кусков сохраняется и для некоммутативной функции (склейка строк)
+        Stack<std::string> letters;
+        for (int i = 0; i < 200; ++i) {
+            letters.Push(std::string(1, static_cast<char>('a' + i % 26)));
+        }
+        auto append = [](const std::string& x, const std::string& acc) { return acc + x; };
+        assert(letters.ParallelReduce(append, std::string(">"), 9, 4) == letters.Reduce(append, std::string(">")));
+        assert(Stack<int>().ParallelReduce(sum, 42) == 42);
+        std::cout << "Parallel reduce (sum): " << stack8.ParallelReduce(sum, 0, 256, 4) << std::endl;
+
     } catch (const std::exception& e) {
         std::cout << "\n!!! Exception caught in test: " << e.what() << " !!!" << std::endl;
     }
@@ -3,6 +3,7 @@
 #include <fstream>
 #include <cassert>
 #include <functional>
+#include <string>
 
 void testSegmentedDeque() {
     // Открываем файл для записи
@@ -120,6 +121,38 @@ void testSegmentedDeque() {
     assert(is_sorted);
     outFile << " ✓" << std::endl;
     
+    // Тест 7: Параллельные map/where/reduce совпадают с последовательными
+    outFile << "\nTest 7: Parallel operations...";
+    SegmentedDeque<int> large;
+    for (int i = 0; i < 10007; ++i) {
+        large.push_back((i * 7919) % 10007);
+    }
+    auto tripled = large.parallel_map<long long>([](const int& x) { return 3LL * x; }, 1000, 4);
+    assert(tripled.size() == large.size());
+    for (int i = 0; i < large.size(); ++i) {
+        assert(tripled[i] == 3LL * large[i]);
+    }
+    auto small = large.parallel_where([](const int& x) { return x < 100; }, 999, 3);
+    auto small_seq = large.where([](const int& x) { return x < 100; });
+    assert(small.size() == small_seq.size());
+    for (int i = 0; i < small.size(); ++i) {
+        assert(small[i] == small_seq[i]);
+    }
+    long long parallel_sum = tripled.parallel_reduce([](long long acc, const long long& x) { return acc + x; }, 0, 512, 4);
+    outFile << "\n  Parallel sum: " << parallel_sum;
+    assert(parallel_sum == 3LL * 10006 * 10007 / 2);
+
+    // Ассоциативная, но не коммутативная свёртка: порядок кусков сохраняется
+    SegmentedDeque<std::string> words;
+    for (int i = 0; i < 100; ++i) {
+        words.push_back(std::string(1, static_cast<char>('a' + i % 26)));
+    }
+    auto concat_words = [](std::string acc, const std::string& x) { return acc + x; };
+    assert(words.parallel_reduce(concat_words, ">", 7, 4) == words.reduce<std::string>(concat_words, ">"));
+    auto empty_map = SegmentedDeque<int>().parallel_map<int>([](const int& x) { return x; });
+    assert(empty_map.empty());
+    outFile << " ✓" << std::endl;
+    
     outFile << "\n=== All SegmentedDeque tests passed successfully! ===" << std::endl;
     
     outFile.close();
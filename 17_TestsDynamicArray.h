@@ -0,0 +1,276 @@
+#include "1_ArraySequence.h"
+#include "2_ListSequence.h"
+#include <iostream>
+#include <fstream>
+#include <cassert>
+#include <string>
+#include <utility>
+#include <thread>
+#include <vector>
+#include <sstream>
+#include <iterator>
+#include <cstdlib>
+
+// Вставка диапазонов в начало, середину и конец хранилища ListSequence против std::vector
+template <class List> bool checkListRangeInsertion() {
+    List list;
+    std::vector<std::string> reference;
+    std::srand(11);
+    for (int step = 0; step < 200; ++step) {
+        std::vector<std::string> run;
+        for (int i = std::rand() % 5; i > 0; --i) {
+            run.push_back(std::to_string(step * 10 + i));
+        }
+        std::string single = (step % 5 == 0 ? "p" : "a") + std::to_string(step);
+        if (step % 5 == 0) {
+            list.Prepend(single);
+            reference.insert(reference.begin(), single);
+        }
+        else {
+            list.Append(single);
+            reference.push_back(single);
+        }
+        int index = step % 7 == 0 ? 0 : step % 7 == 1 ? list.GetLength() : std::rand() % (list.GetLength() + 1);
+        list.InsertRange(index, run.begin(), run.end());
+        reference.insert(reference.begin() + index, run.begin(), run.end());
+    }
+    if (list.GetLength() != static_cast<int>(reference.size())) return false;
+    int index = 0;
+    for (const std::string& item : list) {
+        if (item != reference[index] || list.Get(index) != reference[index]) return false;
+        ++index;
+    }
+    return list.GetLast() == reference.back();
+}
+
+void testDynamicArray() {
+    std::ofstream outFile("outputDynArr.txt");
+    if (!outFile) {
+        std::cerr << "Не удалось открыть файл outputDynArr.txt для записи" << std::endl;
+        return;
+    }
+
+    outFile << "=== Starting DynamicArray tests ===" << std::endl;
+
+    // Тест 1: Геометрический рост ёмкости
+    outFile << "\nTest 1: Geometric growth...";
+    DynamicArray<int> arr(0);
+    int reallocations = 0;
+    int lastCapacity = arr.Capacity();
+    for (int i = 0; i < 1000; ++i) {
+        arr.Resize(arr.GetSize() + 1);
+        arr.Set(i, i);
+        if (arr.Capacity() != lastCapacity) {
+            reallocations++;
+            lastCapacity = arr.Capacity();
+        }
+    }
+    outFile << " size = " << arr.GetSize() << ", capacity = " << arr.Capacity()
+            << ", reallocations = " << reallocations;
+    assert(arr.GetSize() == 1000);
+    assert(arr.Capacity() >= 1000);
+    assert(reallocations <= 11);
+    assert(arr.Get(0) == 0 && arr.Get(999) == 999);
+    outFile << " ✓" << std::endl;
+
+    // Тест 2: Уменьшение размера не освобождает память
+    outFile << "\nTest 2: Shrink and ShrinkToFit...";
+    int capacityBefore = arr.Capacity();
+    arr.Resize(10);
+    outFile << "\n  After Resize(10): size = " << arr.GetSize() << ", capacity = " << arr.Capacity();
+    assert(arr.GetSize() == 10);
+    assert(arr.Capacity() == capacityBefore);
+    arr.ShrinkToFit();
+    outFile << "\n  After ShrinkToFit: size = " << arr.GetSize() << ", capacity = " << arr.Capacity();
+    assert(arr.Capacity() == 10);
+    assert(arr.Get(9) == 9);
+    outFile << " ✓" << std::endl;
+
+    // Тест 3: Reserve
+    outFile << "\nTest 3: Reserve...";
+    MutableArraySequence<int> seq;
+    seq.Reserve(500);
+    int reservedCapacity = seq.Capacity();
+    for (int i = 0; i < 500; ++i) {
+        seq.Append(i);
+    }
+    outFile << " capacity = " << seq.Capacity() << ", length = " << seq.GetLength();
+    assert(reservedCapacity == 500);
+    assert(seq.Capacity() == 500);
+    assert(seq.GetLength() == 500);
+    assert(seq.GetLast() == 499);
+    seq.Reserve(10);
+    assert(seq.Capacity() == 500);
+    outFile << " ✓" << std::endl;
+
+    // Тест 4: Исключения
+    outFile << "\nTest 4: Exceptions...";
+    bool thrown = false;
+    try {
+        arr.Reserve(-1);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+    thrown = false;
+    try {
+        arr.Get(10);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    outFile << " ✓" << std::endl;
+
+    // Тест 5: Emplace и перемещение
+    outFile << "\nTest 5: Emplace and move semantics...";
+    MutableArraySequence<std::string> words;
+    words.EmplaceBack(3, 'b');
+    words.EmplaceBack("ddd");
+    words.Emplace(0, "aaa");
+    words.Emplace(2, 3, 'c');
+    words.Prepend(std::string("start"));
+    outFile << "\n  Words: " << words.ToString();
+    assert(words.GetLength() == 5);
+    assert(words.Get(0) == "start");
+    assert(words.Get(1) == "aaa");
+    assert(words.Get(2) == "bbb");
+    assert(words.Get(3) == "ccc");
+    assert(words.Get(4) == "ddd");
+
+    MutableArraySequence<std::string> moved(std::move(words));
+    assert(moved.GetLength() == 5);
+    assert(words.GetLength() == 0);
+    words = std::move(moved);
+    assert(words.GetLength() == 5);
+    assert(words.GetLast() == "ddd");
+
+    DynamicArray<std::string> strings(2);
+    assert(strings.Get(0).empty() && strings.Get(1).empty());
+    strings.EmplaceBack(strings.Get(0) + "x");
+    strings.Resize(1);
+    assert(strings.GetSize() == 1);
+    outFile << " ✓" << std::endl;
+
+    // Тест 6: копирование при записи
+    outFile << "\nTest 6: Copy-on-write...";
+    DynamicArray<std::string> original(3);
+    original.Set(0, "a");
+    original.Set(1, "b");
+    original.Set(2, "c");
+    DynamicArray<std::string> shared(original);
+    assert(shared.IsShared() && original.IsShared());
+    assert(static_cast<const DynamicArray<std::string>&>(shared).Data() == static_cast<const DynamicArray<std::string>&>(original).Data());
+    shared.Set(1, "x");
+    assert(!shared.IsShared() && !original.IsShared());
+    assert(original.Get(1) == "b" && shared.Get(1) == "x");
+
+    DynamicArray<std::string> appended(original);
+    appended.EmplaceBack("d");
+    assert(original.GetSize() == 3 && appended.GetSize() == 4 && appended.Get(0) == "a");
+    DynamicArray<std::string> assigned(0);
+    assigned = original;
+    assert(assigned.IsShared());
+    assigned.Resize(1);
+    assert(original.GetSize() == 3 && assigned.GetSize() == 1);
+    for (std::string& item : assigned) {
+        item += "!";
+    }
+    assert(assigned.Get(0) == "a!" && original.Get(0) == "a");
+
+    MutableArraySequence<int> numbers;
+    for (int i = 0; i < 1000; ++i) {
+        numbers.Append(i);
+    }
+    MutableArraySequence<int>* clone = static_cast<MutableArraySequence<int>*>(numbers.Clone());
+    assert(clone->begin() == numbers.begin());
+    clone->Append(1000);
+    assert(clone->begin() != numbers.begin() && numbers.GetLength() == 1000 && clone->GetLength() == 1001);
+    delete clone;
+
+    // Копии одного буфера меняются из разных потоков
+    DynamicArray<int> source(10000);
+    std::vector<DynamicArray<int>> copies(4, source);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; ++t) {
+        workers.push_back(std::thread([&copies, t]() {
+            for (int i = 0; i < copies[t].GetSize(); ++i) {
+                copies[t].Set(i, t);
+            }
+            copies[t].EmplaceBack(t);
+        }));
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    for (int t = 0; t < 4; ++t) {
+        assert(copies[t].GetSize() == 10001 && copies[t].Get(5000) == t);
+    }
+    assert(source.Get(5000) == 0 && !source.IsShared());
+    outFile << " ✓" << std::endl;
+
+    // Тест 7: вставка диапазонов
+    outFile << "\nTest 7: Range insertion...";
+    int digits[] = {1, 2, 3, 4, 5};
+    DynamicArray<int> ints(digits, digits + 5);
+    ints.Reserve(32);
+    ints.InsertRange(2, digits, digits + 3);
+    assert(ints.ToString() == "[1, 2, 1, 2, 3, 3, 4, 5]");
+    ints.InsertRange(1, ints.begin() + 4, ints.end());
+    assert(ints.ToString() == "[1, 3, 3, 4, 5, 2, 1, 2, 3, 3, 4, 5]");
+    DynamicArray<int> intsCopy(ints);
+    ints.AppendRange(digits, digits + 2);
+    assert(ints.GetSize() == 14 && intsCopy.GetSize() == 12 && !intsCopy.IsShared());
+
+    std::string names[] = {"a", "b", "c"};
+    DynamicArray<std::string> letters(0);
+    letters.AppendRange(names, names + 3);
+    letters.InsertRange(0, letters.begin(), letters.end());
+    letters.InsertRange(3, names + 1, names + 2);
+    assert(letters.ToString() == "[a, b, c, b, a, b, c]");
+
+    std::istringstream input("7 8 9");
+    DynamicArray<int> parsed((std::istream_iterator<int>(input)), std::istream_iterator<int>());
+    assert(parsed.ToString() == "[7, 8, 9]");
+    outFile << " ✓" << std::endl;
+
+    // Тест 8: диапазоны в последовательностях
+    outFile << "\nTest 8: Sequence ranges...";
+    MutableArraySequence<int> mutableArray(digits, digits + 3);
+    mutableArray.PrependRange(digits + 3, digits + 5);
+    mutableArray.AppendRange(mutableArray.begin(), mutableArray.end());
+    assert(mutableArray.ToString() == "[4, 5, 1, 2, 3, 4, 5, 1, 2, 3]");
+
+    ImmutableArraySequence<int> frozen(digits, digits + 2);
+    ArraySequence<int>* grown = frozen.InsertRange(1, digits + 2, digits + 5);
+    assert(grown->ToString() == "[1, 3, 4, 5, 2]" && frozen.ToString() == "[1, 2]");
+    delete grown;
+
+    MutableListSequence<int> list(digits, digits + 2);
+    list.InsertRange(1, mutableArray.begin(), mutableArray.begin() + 2);
+    list.AppendRange(list.begin(), list.end());
+    assert(list.ToString() == "[1, 4, 5, 2, 1, 4, 5, 2]");
+    ImmutableListSequence<int> frozenList(digits, digits + 1);
+    ListSequence<int, PersistentList<int>>* prepended = frozenList.PrependRange(digits + 1, digits + 3);
+    assert(prepended->ToString() == "[2, 3, 1]" && frozenList.GetLength() == 1);
+    delete prepended;
+
+    bool listsMatch = checkListRangeInsertion<LinkedList<std::string>>()
+                   && checkListRangeInsertion<UnrolledLinkedList<std::string>>()
+                   && checkListRangeInsertion<DoublyLinkedList<std::string>>()
+                   && checkListRangeInsertion<PersistentList<std::string>>();
+    assert(listsMatch);
+
+    thrown = false;
+    try {
+        mutableArray.InsertRange(11, digits, digits + 1);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    outFile << " ✓" << std::endl;
+
+    outFile << "\n=== All DynamicArray tests passed successfully! ===" << std::endl;
+
+    outFile.close();
+    std::cout << "Тесты завершены. Результаты записаны в outputDynArr.txt" << std::endl;
+}
@@ -0,0 +1,1027 @@
+#include "1_ArraySequence.h"
+#include "2_ListSequence.h"
+#include "4_LinkedList.h"
+#include "21_UnrolledLinkedList.h"
+#include "33_StaticSequence.h"
+#include "5_Linearform.h"
+#include "38_SparseLinearForm.h"
+#include "7_Stack.h"
+#include "8_SegmentedDeque.h"
+#include "40_ConcurrentStack.h"
+#include "42_EliminationStack.h"
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <iomanip>
+#include <string>
+#include <ctime>
+#include <list>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Время выполнения f() в миллисекундах
+template <class F>
+double measureMs(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto finish = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(finish - start).count();
+}
+
+// Append в MutableArraySequence: время на элемент должно оставаться постоянным.
+// Колонка "exact fit" воспроизводит старое поведение (ёмкость == размер).
+void benchArrayAppend(std::ostream& out) {
+    out << "=== ArraySequence Append ===" << std::endl;
+    out << std::setw(10) << "N" << std::setw(14) << "total ms" << std::setw(14) << "ns/item"
+        << std::setw(18) << "exact fit ms" << std::endl;
+
+    for (int n = 10000; n <= 1280000; n *= 2) {
+        double ms = measureMs([n]() {
+            MutableArraySequence<int> seq;
+            for (int i = 0; i < n; ++i) {
+                seq.Append(i);
+            }
+        });
+
+        out << std::setw(10) << n << std::setw(14) << std::fixed << std::setprecision(2) << ms
+            << std::setw(14) << ms * 1e6 / n;
+
+        if (n <= 20000) {
+            double exactMs = measureMs([n]() {
+                MutableArraySequence<int> seq;
+                for (int i = 0; i < n; ++i) {
+                    seq.Append(i);
+                    seq.ShrinkToFit();
+                }
+            });
+            out << std::setw(18) << exactMs;
+        }
+        out << std::endl;
+    }
+    out << std::endl;
+}
+
+// Запись, похожая на Person: несколько строк длиннее SSO-буфера
+struct PersonRecord {
+    std::string firstName;
+    std::string middleName;
+    std::string lastName;
+    time_t birthDate;
+
+    static long copies;
+    static long moves;
+
+    PersonRecord() : birthDate(0) {}
+    PersonRecord(const std::string& fName, const std::string& mName, const std::string& lName, time_t bDate)
+        : firstName(fName), middleName(mName), lastName(lName), birthDate(bDate) {}
+    PersonRecord(const PersonRecord& other)
+        : firstName(other.firstName), middleName(other.middleName), lastName(other.lastName),
+          birthDate(other.birthDate) { copies++; }
+    PersonRecord(PersonRecord&& other) noexcept
+        : firstName(std::move(other.firstName)), middleName(std::move(other.middleName)),
+          lastName(std::move(other.lastName)), birthDate(other.birthDate) { moves++; }
+    PersonRecord& operator=(const PersonRecord& other) {
+        firstName = other.firstName;
+        middleName = other.middleName;
+        lastName = other.lastName;
+        birthDate = other.birthDate;
+        copies++;
+        return *this;
+    }
+    PersonRecord& operator=(PersonRecord&& other) noexcept {
+        firstName = std::move(other.firstName);
+        middleName = std::move(other.middleName);
+        lastName = std::move(other.lastName);
+        birthDate = other.birthDate;
+        moves++;
+        return *this;
+    }
+};
+
+long PersonRecord::copies = 0;
+long PersonRecord::moves = 0;
+
+std::ostream& operator<<(std::ostream& out, const PersonRecord& person) {
+    return out << person.lastName;
+}
+
+// Добавление тяжёлых элементов: строки и записи из нескольких строк
+void benchHeavyElements(std::ostream& out) {
+    out << "=== Heavy elements ===" << std::endl;
+    const int n = 200000;
+    const std::string longName = "Konstantin-Konstantinovich-Konstantinopolsky";
+
+    double appendMs = measureMs([&]() {
+        MutableArraySequence<std::string> seq;
+        for (int i = 0; i < n; ++i) {
+            seq.Append(longName);
+        }
+    });
+    double emplaceMs = measureMs([&]() {
+        MutableArraySequence<std::string> seq;
+        for (int i = 0; i < n; ++i) {
+            seq.EmplaceBack(longName.c_str());
+        }
+    });
+    out << "std::string  Append: " << std::fixed << std::setprecision(2) << appendMs << " ms"
+        << ", EmplaceBack: " << emplaceMs << " ms" << std::endl;
+
+    PersonRecord::copies = 0;
+    PersonRecord::moves = 0;
+    double personMs = measureMs([&]() {
+        MutableArraySequence<PersonRecord> seq;
+        for (int i = 0; i < n; ++i) {
+            seq.EmplaceBack(longName, longName, longName, static_cast<time_t>(i));
+        }
+    });
+    out << "PersonRecord EmplaceBack: " << personMs << " ms, copies = " << PersonRecord::copies
+        << ", moves = " << PersonRecord::moves << std::endl;
+
+    PersonRecord::copies = 0;
+    PersonRecord::moves = 0;
+    double prependMs = measureMs([&]() {
+        MutableArraySequence<PersonRecord> seq;
+        for (int i = 0; i < 2000; ++i) {
+            seq.Prepend(PersonRecord(longName, longName, longName, static_cast<time_t>(i)));
+        }
+    });
+    out << "PersonRecord Prepend x2000: " << prependMs << " ms, copies = " << PersonRecord::copies
+        << ", moves = " << PersonRecord::moves << std::endl;
+    out << std::endl;
+}
+
+// Постоянное создание и уничтожение списков. std::list берёт каждый узел
+// у malloc и служит точкой отсчёта; LinkedList берёт узлы из своего пула.
+void benchListChurn(std::ostream& out) {
+    out << "=== LinkedList churn ===" << std::endl;
+    const int rounds = 2000;
+    const int n = 500;
+    long checksum = 0;
+
+    double stdListMs = measureMs([&]() {
+        for (int round = 0; round < rounds; ++round) {
+            std::list<int> list;
+            for (int i = 0; i < n; ++i) {
+                list.push_back(i);
+            }
+            checksum += list.back();
+        }
+    });
+    double linkedListMs = measureMs([&]() {
+        for (int round = 0; round < rounds; ++round) {
+            LinkedList<int> list;
+            for (int i = 0; i < n; ++i) {
+                list.Append(i);
+            }
+            checksum += list.GetLast();
+        }
+    });
+    double reuseMs = measureMs([&]() {
+        LinkedList<int> list;
+        LinkedList<int> empty;
+        for (int round = 0; round < rounds; ++round) {
+            list = empty;
+            for (int i = 0; i < n; ++i) {
+                list.Append(i);
+            }
+            checksum += list.GetLast();
+        }
+    });
+
+    out << std::fixed << std::setprecision(2);
+    out << rounds << " x " << n << " appends" << std::endl;
+    out << "std::list (malloc per node):   " << stdListMs << " ms" << std::endl;
+    out << "LinkedList (per-list pool):    " << linkedListMs << " ms" << std::endl;
+    out << "LinkedList (reused via =):     " << reuseMs << " ms" << std::endl;
+    out << "(checksum " << checksum << ")" << std::endl << std::endl;
+}
+
+// Обход и доступ по индексу: LinkedList против UnrolledLinkedList
+template <class List>
+void benchListAccess(std::ostream& out, const char* name, int n) {
+    List list;
+    for (int i = 0; i < n; ++i) {
+        list.Append(i);
+    }
+
+    long checksum = 0;
+    double sequentialMs = measureMs([&]() {
+        for (int i = 0; i < n; ++i) {
+            checksum += list.Get(i);
+        }
+    });
+    std::srand(1);
+    double randomMs = measureMs([&]() {
+        for (int i = 0; i < 2000; ++i) {
+            checksum += list.Get(std::rand() % n);
+        }
+    });
+    double subListMs = measureMs([&]() {
+        List* sub = list.GetSubList(0, n - 1);
+        checksum += sub->GetLast();
+        delete sub;
+    });
+    double toStringMs = measureMs([&]() {
+        checksum += static_cast<long>(list.ToString().size());
+    });
+
+    out << std::setw(22) << name << std::setw(14) << sequentialMs << std::setw(14) << randomMs << std::setw(14) << subListMs
+        << std::setw(14) << toStringMs << "   (checksum " << checksum << ")" << std::endl;
+}
+
+void benchUnrolledList(std::ostream& out) {
+    const int n = 40000;
+    out << "=== List traversal, N = " << n << " ===" << std::endl;
+    out << std::fixed << std::setprecision(2);
+    out << std::setw(22) << "" << std::setw(14) << "Get(0..n-1)" << std::setw(14) << "2000 random" << std::setw(14) << "GetSubList"
+        << std::setw(14) << "ToString" << std::endl;
+    benchListAccess<LinkedList<int>>(out, "LinkedList", n);
+    benchListAccess<UnrolledLinkedList<int>>(out, "UnrolledLinkedList", n);
+    out << std::endl;
+}
+
+// Цепочка версий через Append у ImmutableArraySequence. "full copy" - прежняя схема,
+// когда каждая версия копировала весь массив
+void benchImmutableAppend(std::ostream& out) {
+    out << "=== ImmutableArraySequence Append chain ===" << std::endl;
+    out << std::setw(10) << "N" << std::setw(16) << "persistent ms" << std::setw(16) << "full copy ms" << std::endl;
+    out << std::fixed << std::setprecision(2);
+
+    long checksum = 0;
+    for (int n = 2500; n <= 10000; n *= 2) {
+        double persistentMs = measureMs([&]() {
+            ArraySequence<int>* current = new ImmutableArraySequence<int>();
+            for (int i = 0; i < n; ++i) {
+                ArraySequence<int>* next = current->Append(i);
+                delete current;
+                current = next;
+            }
+            checksum += current->GetLast();
+            delete current;
+        });
+        double fullCopyMs = measureMs([&]() {
+            ArraySequence<int>* current = new MutableArraySequence<int>();
+            for (int i = 0; i < n; ++i) {
+                ArraySequence<int>* next = current->Clone();
+                next->Append(i);
+                delete current;
+                current = next;
+            }
+            checksum += current->GetLast();
+            delete current;
+        });
+        out << std::setw(10) << n << std::setw(16) << persistentMs << std::setw(16) << fullCopyMs << std::endl;
+    }
+    out << "(checksum " << checksum << ")" << std::endl << std::endl;
+}
+
+// То же для ImmutableListSequence: PersistentList против глубокой копии LinkedList
+template <class List>
+double immutableListChain(int n, long& checksum) {
+    return measureMs([&]() {
+        ListSequence<int, List>* current = new ImmutableListSequence<int, List>();
+        for (int i = 0; i < n; ++i) {
+            ListSequence<int, List>* next = i % 2 == 0 ? current->Append(i) : current->Prepend(i);
+            delete current;
+            current = next;
+        }
+        checksum += current->GetLast();
+        delete current;
+    });
+}
+
+void benchImmutableList(std::ostream& out) {
+    out << "=== ImmutableListSequence Append/Prepend chain ===" << std::endl;
+    out << std::setw(10) << "N" << std::setw(16) << "persistent ms" << std::setw(16) << "deep copy ms" << std::endl;
+    out << std::fixed << std::setprecision(2);
+
+    long checksum = 0;
+    for (int n = 1000; n <= 4000; n *= 2) {
+        double persistentMs = immutableListChain<PersistentList<int>>(n, checksum);
+        double deepCopyMs = immutableListChain<LinkedList<int>>(n, checksum);
+        out << std::setw(10) << n << std::setw(16) << persistentMs << std::setw(16) << deepCopyMs << std::endl;
+    }
+    out << "(checksum " << checksum << ")" << std::endl << std::endl;
+}
+
+// Clone с последующим чтением: общий буфер против глубокой копии
+// (копия в другой ресурс буфер не делит)
+void benchCloneRead(std::ostream& out) {
+    out << "=== ArraySequence Clone + read ===" << std::endl;
+    const int n = 100000;
+    const int clones = 1000;
+    DynamicArray<int> array(0);
+    for (int i = 0; i < n; ++i) {
+        array.EmplaceBack(i);
+    }
+    MutableArraySequence<int> source(array);
+
+    long checksum = 0;
+    double sharedMs = measureMs([&]() {
+        for (int i = 0; i < clones; ++i) {
+            ArraySequence<int>* clone = source.Clone();
+            checksum += clone->Get(i);
+            delete clone;
+        }
+    });
+    NewDeleteResource otherResource;
+    double deepMs = measureMs([&]() {
+        for (int i = 0; i < clones; ++i) {
+            DynamicArray<int> copy(array, &otherResource);
+            checksum += copy.Get(i);
+        }
+    });
+
+    out << std::fixed << std::setprecision(2);
+    out << clones << " clones of " << n << " ints" << std::endl;
+    out << "copy-on-write: " << sharedMs << " ms" << std::endl;
+    out << "deep copy:     " << deepMs << " ms" << std::endl;
+    out << "(checksum " << checksum << ")" << std::endl << std::endl;
+}
+
+// Скользящее окно: копия каждого окна через GetSubsequence против среза без копирования
+void benchWindows(std::ostream& out) {
+    out << "=== Sliding windows over ArraySequence ===" << std::endl;
+    const int n = 1000000;
+    const int width = 1000;
+    const int windows = 5000;
+    MutableArraySequence<int> buffer;
+    buffer.Reserve(n);
+    for (int i = 0; i < n; ++i) {
+        buffer.Append(i % 100);
+    }
+
+    long checksum = 0;
+    double copyMs = measureMs([&]() {
+        for (int w = 0; w < windows; ++w) {
+            ArraySequence<int>* window = buffer.GetSubsequence(w * 100, w * 100 + width - 1);
+            for (int item : *window) {
+                checksum += item;
+            }
+            delete window;
+        }
+    });
+    double viewMs = measureMs([&]() {
+        for (int w = 0; w < windows; ++w) {
+            SequenceView<int> window = buffer.GetSubsequenceView(w * 100, w * 100 + width - 1);
+            for (const int* item = window.Data(); item != window.Data() + width; ++item) {
+                checksum += *item;
+            }
+        }
+    });
+
+    out << std::fixed << std::setprecision(2);
+    out << windows << " windows of " << width << " over " << n << " ints" << std::endl;
+    out << "GetSubsequence (copy): " << copyMs << " ms" << std::endl;
+    out << "GetSubsequenceView:    " << viewMs << " ms" << std::endl;
+    out << "(checksum " << checksum << ")" << std::endl << std::endl;
+}
+
+// Перенос блока элементов: цикл Append против одного AppendRange / InsertRange
+void benchRanges(std::ostream& out) {
+    out << "=== Bulk insertion into MutableArraySequence ===" << std::endl;
+    const int n = 100000;
+    const int rounds = 100;
+    MutableArraySequence<int> source;
+    for (int i = 0; i < n; ++i) {
+        source.Append(i);
+    }
+
+    long checksum = 0;
+    double loopMs = measureMs([&]() {
+        for (int r = 0; r < rounds; ++r) {
+            MutableArraySequence<int> target;
+            for (int i = 0; i < source.GetLength(); ++i) {
+                target.Append(source.Get(i));
+            }
+            checksum += target.GetLast();
+        }
+    });
+    double rangeMs = measureMs([&]() {
+        for (int r = 0; r < rounds; ++r) {
+            MutableArraySequence<int> target;
+            target.AppendRange(source.begin(), source.end());
+            checksum += target.GetLast();
+        }
+    });
+    double insertMs = measureMs([&]() {
+        for (int r = 0; r < rounds; ++r) {
+            MutableArraySequence<int> target(source.begin(), source.begin() + 1000);
+            target.InsertRange(500, source.begin(), source.end());
+            checksum += target.Get(500);
+        }
+    });
+
+    out << std::fixed << std::setprecision(2);
+    out << rounds << " copies of " << n << " ints" << std::endl;
+    out << "Append loop:          " << loopMs << " ms" << std::endl;
+    out << "AppendRange:          " << rangeMs << " ms" << std::endl;
+    out << "InsertRange (middle): " << insertMs << " ms" << std::endl;
+    out << "(checksum " << checksum << ")" << std::endl << std::endl;
+}
+
+// Одна и та же работа через виртуальный Sequence<T> и через StaticArraySequence
+void benchStaticDispatch(std::ostream& out) {
+    out << "=== Virtual vs static dispatch ===" << std::endl;
+    const int n = 1000000;
+    const int rounds = 20;
+    MutableArraySequence<int> array;
+    StaticArraySequence<int> fixed;
+    for (int i = 0; i < n; ++i) {
+        array.Append(i % 100);
+        fixed.Append(i % 100);
+    }
+    // Указатель на базовый класс выбирается по времени, чтобы компилятор не знал точный тип
+    SequenceAdapter<StaticArraySequence<int>> adapter(fixed);
+    Sequence<int>* erased = std::time(nullptr) % 2 == 0 ? static_cast<Sequence<int>*>(&array) : &adapter;
+
+    long checksum = 0;
+    double virtualGetMs = measureMs([&]() {
+        for (int r = 0; r < rounds; ++r) {
+            for (int i = 0; i < erased->GetLength(); ++i) {
+                checksum += erased->Get(i);
+            }
+        }
+    });
+    double staticGetMs = measureMs([&]() {
+        for (int r = 0; r < rounds; ++r) {
+            for (int i = 0; i < fixed.GetLength(); ++i) {
+                checksum += fixed.Get(i);
+            }
+        }
+    });
+    double staticReduceMs = measureMs([&]() {
+        for (int r = 0; r < rounds; ++r) {
+            checksum += fixed.Reduce([](int x, int sum) { return x + sum; }, 0);
+        }
+    });
+
+    double virtualAppendMs = measureMs([&]() {
+        for (int r = 0; r < rounds; ++r) {
+            Sequence<int>* target = r % 2 == 0 ? static_cast<Sequence<int>*>(new MutableArraySequence<int>())
+                                                : new SequenceAdapter<StaticArraySequence<int>>();
+            for (int i = 0; i < n / 10; ++i) {
+                target->Append(i);
+            }
+            checksum += target->GetLast();
+            delete target;
+        }
+    });
+    double staticAppendMs = measureMs([&]() {
+        for (int r = 0; r < rounds; ++r) {
+            StaticArraySequence<int> target;
+            for (int i = 0; i < n / 10; ++i) {
+                target.Append(i);
+            }
+            checksum += target.GetLast();
+        }
+    });
+
+    out << std::fixed << std::setprecision(2);
+    out << rounds << " passes over " << n << " ints, " << rounds << " x " << n / 10 << " appends" << std::endl;
+    out << "Sequence<T>::Get (virtual):      " << virtualGetMs << " ms" << std::endl;
+    out << "StaticArraySequence::Get:        " << staticGetMs << " ms" << std::endl;
+    out << "StaticArraySequence::Reduce:     " << staticReduceMs << " ms" << std::endl;
+    out << "Sequence<T>::Append (virtual):   " << virtualAppendMs << " ms" << std::endl;
+    out << "StaticArraySequence::Append:     " << staticAppendMs << " ms" << std::endl;
+    out << "(checksum " << checksum << ")" << std::endl << std::endl;
+}
+
+// Сложение и умножение форм: векторные ядра против скалярного цикла по Get(i).
+// Число повторов подобрано так, чтобы на каждую размерность приходилось ~4M элементов
+void benchLinearForm(std::ostream& out) {
+    out << "=== LinearForm Add / Multiply, double ===" << std::endl;
+    out << std::setw(10) << "N" << std::setw(14) << "Get loop ms" << std::setw(14) << "kernel ms"
+        << std::setw(14) << "Multiply ms" << std::endl;
+    out << std::fixed << std::setprecision(2);
+    double checksum = 0;
+    for (int n = 4; n <= 1048576; n *= 8) {
+        int rounds = 4194304 / n;
+        DynamicArray<double> values(n);
+        for (int i = 0; i < n; ++i) {
+            values.Set(i, i * 0.5);
+        }
+        LinearForm<double> left(values.Data(), n);
+        LinearForm<double> right(values.Data(), n);
+
+        double loopMs = measureMs([&]() {
+            for (int r = 0; r < rounds; ++r) {
+                MutableArraySequence<double> sum;
+                sum.Reserve(n);
+                for (int i = 0; i < n; ++i) {
+                    sum.Append(left.Get(i) + right.Get(i));
+                }
+                checksum += sum.GetLast();
+            }
+        });
+        double kernelMs = measureMs([&]() {
+            for (int r = 0; r < rounds; ++r) {
+                LinearForm<double>* sum = left.Add(right);
+                checksum += sum->GetLast();
+                delete sum;
+            }
+        });
+        double scaleMs = measureMs([&]() {
+            for (int r = 0; r < rounds; ++r) {
+                LinearForm<double>* scaled = left.Multiply(3.0);
+                checksum += scaled->GetLast();
+                delete scaled;
+            }
+        });
+        out << std::setw(10) << n << std::setw(14) << loopMs << std::setw(14) << kernelMs
+            << std::setw(14) << scaleMs << std::endl;
+    }
+    out << "(checksum " << checksum << ")" << std::endl << std::endl;
+}
+
+// Значения формы на наборе точек: Evaluate по точке против EvaluateBatch в обеих раскладках
+// и на всех ядрах; последняя колонка - 8 форм за один проход по точкам
+void benchBatchEvaluate(std::ostream& out) {
+    out << "=== LinearForm EvaluateBatch, double, 64 variables ===" << std::endl;
+    out << std::setw(10) << "points" << std::setw(14) << "Evaluate ms" << std::setw(14) << "rows ms"
+        << std::setw(14) << "columns ms" << std::setw(14) << "threads ms" << std::setw(14) << "8 forms ms" << std::endl;
+    out << std::fixed << std::setprecision(2);
+    const int dim = 64;
+    double checksum = 0;
+    for (int count = 1000; count <= 1000000; count *= 10) {
+        DynamicArray<double> rows(count * dim), columns(count * dim);
+        for (int p = 0; p < count; ++p) {
+            for (int j = 0; j < dim; ++j) {
+                double x = (p + j) % 17 * 0.25;
+                rows.Set(p * dim + j, x);
+                columns.Set(j * count + p, x);
+            }
+        }
+        DynamicArray<LinearForm<double>> forms(0);
+        for (int f = 0; f < 8; ++f) {
+            DynamicArray<double> coefficients(dim + 1);
+            for (int i = 0; i <= dim; ++i) {
+                coefficients.Set(i, (i + f) % 7 - 3);
+            }
+            forms.EmplaceBack(coefficients.Data(), dim + 1);
+        }
+        const LinearForm<double>& form = forms.Data()[0];
+
+        double pointMs = measureMs([&]() {
+            MutableArraySequence<double> point;
+            for (int p = 0; p < count; ++p) {
+                point = MutableArraySequence<double>(rows.Data() + p * dim, dim);
+                checksum += form.Evaluate(point);
+            }
+        });
+        auto batchMs = [&](const DynamicArray<double>& points, MatrixLayout layout, int threads) {
+            return measureMs([&]() {
+                ArraySequence<double>* values = form.EvaluateBatch(points.Data(), count, layout, threads);
+                checksum += values->GetLast();
+                delete values;
+            });
+        };
+        double rowsMs = batchMs(rows, ROW_MAJOR, 1);
+        double columnsMs = batchMs(columns, COLUMN_MAJOR, 1);
+        double threadsMs = batchMs(rows, ROW_MAJOR, 0);
+        double formsMs = measureMs([&]() {
+            ArraySequence<double>* values = LinearForm<double>::EvaluateBatch(forms.Data(), 8, rows.Data(), count, ROW_MAJOR);
+            checksum += values->GetLast();
+            delete values;
+        });
+        out << std::setw(10) << count << std::setw(14) << pointMs << std::setw(14) << rowsMs
+            << std::setw(14) << columnsMs << std::setw(14) << threadsMs << std::setw(14) << formsMs << std::endl;
+    }
+    out << "(checksum " << checksum << ")" << std::endl << std::endl;
+}
+
+// Многочлен высокой степени: старый цикл с накоплением степени, Горнер, Эстрин
+// и векторный Горнер по 1024 точкам. Время - на одно вычисление
+void benchPolynomial(std::ostream& out) {
+    out << "=== LinearForm Evaluate(x), double, ns per point ===" << std::endl;
+    out << std::setw(10) << "degree" << std::setw(14) << "powers" << std::setw(14) << "Horner"
+        << std::setw(14) << "Estrin" << std::setw(14) << "batch" << std::endl;
+    out << std::fixed << std::setprecision(2);
+    const int points = 1024;
+    DynamicArray<double> xs(points);
+    for (int p = 0; p < points; ++p) {
+        xs.Set(p, -1.0 + 2.0 * p / points);
+    }
+    double checksum = 0;
+    for (int degree = 4; degree <= 4096; degree *= 4) {
+        DynamicArray<double> coefficients(degree + 1);
+        for (int i = 0; i <= degree; ++i) {
+            coefficients.Set(i, 1.0 / (i + 1));
+        }
+        LinearForm<double> form(coefficients.Data(), degree + 1);
+        int rounds = std::max(1, 4194304 / (degree * points));
+
+        double powersMs = measureMs([&]() {
+            for (int r = 0; r < rounds; ++r) {
+                for (int p = 0; p < points; ++p) {
+                    double x = xs.Get(p);
+                    double result = coefficients.Get(0);
+                    double power = x;
+                    for (int i = 1; i <= degree; ++i) {
+                        result += coefficients.Get(i) * power;
+                        power *= x;
+                    }
+                    checksum += result;
+                }
+            }
+        });
+        double hornerMs = measureMs([&]() {
+            for (int r = 0; r < rounds; ++r) {
+                for (int p = 0; p < points; ++p) checksum += form.Evaluate(xs.Get(p));
+            }
+        });
+        double estrinMs = measureMs([&]() {
+            for (int r = 0; r < rounds; ++r) {
+                for (int p = 0; p < points; ++p) checksum += form.EvaluateEstrin(xs.Get(p));
+            }
+        });
+        double batchMs = measureMs([&]() {
+            for (int r = 0; r < rounds; ++r) {
+                ArraySequence<double>* values = form.EvaluateMany(xs.Data(), points);
+                checksum += values->GetLast();
+                delete values;
+            }
+        });
+        double scale = 1e6 / (static_cast<double>(rounds) * points);
+        out << std::setw(10) << degree << std::setw(14) << powersMs * scale << std::setw(14) << hornerMs * scale
+            << std::setw(14) << estrinMs * scale << std::setw(14) << batchMs * scale << std::endl;
+    }
+    out << "(checksum " << checksum << ")" << std::endl << std::endl;
+}
+
+// a + b * 2 - c: цепочка методов с промежуточными формами в куче против ленивого выражения.
+// Цепочка выделяет 3 формы и 3 буфера и проходит по памяти 8n раз, выражение - 1 буфер и 4n
+void benchFormExpressions(std::ostream& out) {
+    out << "=== LinearForm a + b * 2 - c, double ===" << std::endl;
+    out << std::setw(10) << "N" << std::setw(14) << "methods ms" << std::setw(14) << "expr ms"
+        << std::setw(14) << "expr GB/s" << std::endl;
+    out << std::fixed << std::setprecision(2);
+    double checksum = 0;
+    for (int n = 16; n <= 1048576; n *= 16) {
+        int rounds = 4194304 / n;
+        DynamicArray<double> values(n);
+        for (int i = 0; i < n; ++i) {
+            values.Set(i, i * 0.5);
+        }
+        LinearForm<double> a(values.Data(), n), b(values.Data(), n), c(values.Data(), n);
+
+        double methodsMs = measureMs([&]() {
+            for (int r = 0; r < rounds; ++r) {
+                LinearForm<double>* doubled = b.Multiply(2.0);
+                LinearForm<double>* sum = a.Add(*doubled);
+                LinearForm<double>* result = sum->Subtract(c);
+                checksum += result->GetLast();
+                delete doubled;
+                delete sum;
+                delete result;
+            }
+        });
+        double expressionMs = measureMs([&]() {
+            for (int r = 0; r < rounds; ++r) {
+                LinearForm<double> result = a + b * 2.0 - c;
+                checksum += result.GetLast();
+            }
+        });
+        double bytes = 4.0 * sizeof(double) * n * rounds;
+        out << std::setw(10) << n << std::setw(14) << methodsMs << std::setw(14) << expressionMs
+            << std::setw(14) << bytes / (expressionMs * 1e6) << std::endl;
+    }
+    out << "(checksum " << checksum << ")" << std::endl << std::endl;
+}
+
+// Форма на 1M переменных с nnz ненулевыми: плотная против разреженной.
+// Время разреженной растёт с nnz, плотной - не зависит от него
+void benchSparseLinearForm(std::ostream& out) {
+    out << "=== LinearForm vs SparseLinearForm, 1M variables, double ===" << std::endl;
+    out << std::setw(10) << "nnz" << std::setw(14) << "dense Add" << std::setw(14) << "sparse Add"
+        << std::setw(14) << "dense Eval" << std::setw(14) << "sparse Eval" << std::endl;
+    out << std::fixed << std::setprecision(4);
+    const int length = 1000001;
+    const int rounds = 20;
+    DynamicArray<double> point(length - 1);
+    for (int i = 0; i < length - 1; ++i) {
+        point.Set(i, (i % 13) * 0.5);
+    }
+    MutableArraySequence<double> variables(std::move(point));
+    double checksum = 0;
+    for (int nnz = 100; nnz <= 100000; nnz *= 10) {
+        DynamicArray<int> indices(0);
+        DynamicArray<double> values(0);
+        DynamicArray<double> denseItems(length);
+        for (int i = 0; i < length; ++i) {
+            denseItems.Set(i, 0.0);
+        }
+        for (int k = 0; k < nnz; ++k) {
+            int index = static_cast<int>(static_cast<long long>(k) * length / nnz);
+            indices.EmplaceBack(index);
+            values.EmplaceBack(k % 5 + 1.0);
+            denseItems.Set(index, k % 5 + 1.0);
+        }
+        SparseLinearForm<double> sparse(indices.Data(), values.Data(), nnz, length);
+        LinearForm<double> dense(denseItems.Data(), length);
+
+        double denseAddMs = measureMs([&]() {
+            for (int r = 0; r < rounds; ++r) {
+                LinearForm<double> sum = dense + dense;
+                checksum += sum.GetLast();
+            }
+        });
+        double sparseAddMs = measureMs([&]() {
+            for (int r = 0; r < rounds; ++r) {
+                SparseLinearForm<double>* sum = sparse.Add(sparse);
+                checksum += sum->GetNonZeroCount();
+                delete sum;
+            }
+        });
+        double denseEvalMs = measureMs([&]() {
+            for (int r = 0; r < rounds; ++r) checksum += dense.Evaluate(variables);
+        });
+        double sparseEvalMs = measureMs([&]() {
+            for (int r = 0; r < rounds; ++r) checksum += sparse.Evaluate(variables);
+        });
+        out << std::setw(10) << nnz << std::setw(14) << denseAddMs / rounds << std::setw(14) << sparseAddMs / rounds
+            << std::setw(14) << denseEvalMs / rounds << std::setw(14) << sparseEvalMs / rounds << std::endl;
+    }
+    out << "(ms per operation, checksum " << checksum << ")" << std::endl << std::endl;
+}
+
+// Push/Pop на стеке. Колонка "copy pop" воспроизводит старый Pop, который
+// копировал весь буфер через GetSubsequence; её меряем только на малых N
+void benchStackPushPop(std::ostream& out) {
+    out << "=== Stack Push/Pop ===" << std::endl;
+    out << std::setw(10) << "N" << std::setw(14) << "push+pop ms" << std::setw(14) << "ns/item"
+        << std::setw(14) << "bulk ms" << std::setw(14) << "copy pop ms" << std::endl;
+    out << std::fixed << std::setprecision(2);
+    long long checksum = 0;
+    for (int n = 1000; n <= 1000000; n *= 10) {
+        double ms = measureMs([&]() {
+            Stack<int> stack;
+            for (int i = 0; i < n; ++i) {
+                stack.Push(i);
+            }
+            while (!stack.IsEmpty()) {
+                checksum += stack.Pop();
+            }
+        });
+        DynamicArray<int> values(n);
+        for (int i = 0; i < n; ++i) {
+            values.Set(i, i);
+        }
+        double bulkMs = measureMs([&]() {
+            Stack<int> stack;
+            stack.PushMany(values.Data(), n);
+            stack.PopMany(n, values.Data());
+            checksum += values.Get(0);
+        });
+        out << std::setw(10) << n << std::setw(14) << ms << std::setw(14) << ms * 1e6 / (2.0 * n)
+            << std::setw(14) << bulkMs;
+        if (n <= 10000) {
+            double copyMs = measureMs([&]() {
+                ArraySequence<int>* buffer = new MutableArraySequence<int>(values.Data(), n);
+                while (buffer->GetLength() > 1) {
+                    checksum += buffer->GetLast();
+                    ArraySequence<int>* shorter = buffer->GetSubsequence(0, buffer->GetLength() - 2);
+                    delete buffer;
+                    buffer = shorter;
+                }
+                delete buffer;
+            });
+            out << std::setw(14) << copyMs;
+        }
+        out << std::endl;
+    }
+    out << "(checksum " << checksum << ")" << std::endl << std::endl;
+}
+
+// Общий LIFO-пул: потоки по очереди кладут и снимают элементы.
+// Stack под мьютексом против ConcurrentStack; время на одну пару Push/Pop
+template <class Worker>
+double measureThreads(int threads, Worker work) {
+    return measureMs([&]() {
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back(work);
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+    });
+}
+
+void benchConcurrentStack(std::ostream& out) {
+    out << "=== Shared stack under contention, ns per push+pop ===" << std::endl;
+    out << std::setw(10) << "threads" << std::setw(16) << "mutex Stack" << std::setw(16) << "ConcurrentStack" << std::endl;
+    out << std::fixed << std::setprecision(2);
+    const int pairs = 200000;
+    unsigned cores = std::thread::hardware_concurrency();
+    int maxThreads = static_cast<int>(cores > 0 ? cores : 1) * 2;
+    std::atomic<long long> checksum(0);
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        Stack<int> locked;
+        std::mutex lock;
+        double mutexMs = measureThreads(threads, [&]() {
+            long long local = 0;
+            for (int i = 0; i < pairs; ++i) {
+                std::lock_guard<std::mutex> guard(lock);
+                locked.Push(i);
+                local += locked.Pop();
+            }
+            checksum += local;
+        });
+
+        ConcurrentStack<int> lockFree;
+        double lockFreeMs = measureThreads(threads, [&]() {
+            long long local = 0;
+            for (int i = 0; i < pairs; ++i) {
+                lockFree.TryPush(i);
+                int value;
+                if (lockFree.TryPop(value)) local += value;
+            }
+            checksum += local;
+        });
+        double scale = 1e6 / (static_cast<double>(pairs) * threads);
+        out << std::setw(10) << threads << std::setw(16) << mutexMs * scale << std::setw(16) << lockFreeMs * scale << std::endl;
+    }
+    out << "(checksum " << checksum.load() << ")" << std::endl << std::endl;
+}
+
+// Масштабирование по потокам от 1 до N: ConcurrentStack против EliminationStack
+// с массивом исключения из 1 и из threads / 2 ячеек. ns на пару Push/Pop и доля погашенных пар
+void benchEliminationStack(std::ostream& out) {
+    out << "=== EliminationStack scaling, ns per push+pop ===" << std::endl;
+    out << std::setw(10) << "threads" << std::setw(16) << "Treiber" << std::setw(16) << "elim x1"
+        << std::setw(16) << "elim x t/2" << std::setw(14) << "eliminated %" << std::endl;
+    out << std::fixed << std::setprecision(2);
+    const int pairs = 100000;
+    unsigned cores = std::thread::hardware_concurrency();
+    int maxThreads = std::max(8, static_cast<int>(cores) * 2);
+    std::atomic<long long> checksum(0);
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        auto run = [&](ConcurrentStack<int>& plain, EliminationStack<int>* elimination) {
+            return measureThreads(threads, [&]() {
+                long long local = 0;
+                for (int i = 0; i < pairs; ++i) {
+                    int value = 0;
+                    if (elimination != nullptr) {
+                        elimination->TryPush(i);
+                        if (elimination->TryPop(value)) local += value;
+                    } else {
+                        plain.TryPush(i);
+                        if (plain.TryPop(value)) local += value;
+                    }
+                }
+                checksum += local;
+            });
+        };
+        ConcurrentStack<int> treiber;
+        double treiberMs = run(treiber, nullptr);
+        EliminationStack<int> narrow(1);
+        double narrowMs = run(narrow, &narrow);
+        EliminationStack<int> wide(std::max(1, threads / 2));
+        double wideMs = run(wide, &wide);
+
+        double scale = 1e6 / (static_cast<double>(pairs) * threads);
+        out << std::setw(10) << threads << std::setw(16) << treiberMs * scale << std::setw(16) << narrowMs * scale
+            << std::setw(16) << wideMs * scale << std::setw(14) << 100.0 * wide.GetEliminated() / (static_cast<double>(pairs) * threads)
+            << std::endl;
+    }
+    out << "(checksum " << checksum.load() << ")" << std::endl << std::endl;
+}
+
+void benchStackPipeline(std::ostream& out) {
+    out << "=== Stack Map -> Where -> Reduce ===" << std::endl;
+    out << std::setw(10) << "N" << std::setw(14) << "chained ms" << std::setw(14) << "fused ms"
+        << std::setw(14) << "speedup" << std::endl;
+    out << std::fixed << std::setprecision(2);
+    long long checksum = 0;
+    for (int n = 1000; n <= 1000000; n *= 10) {
+        Stack<int> stack;
+        for (int i = 0; i < n; ++i) {
+            stack.Push(i);
+        }
+        int factor = 3;
+        auto scale = [factor](int x) { return x * factor + 1; };
+        auto keep = [](int x) { return x % 4 != 0; };
+        auto add = [](int x, int sum) { return (x ^ sum) + 1; };
+
+        // Каждый шаг - отдельный стек и отдельный проход
+        double chainedMs = measureMs([&]() {
+            Stack<int>* mapped = stack.Map(scale);
+            Stack<int>* kept = mapped->Where(keep);
+            checksum += kept->Reduce(add, 0);
+            delete kept;
+            delete mapped;
+        });
+        double fusedMs = measureMs([&]() {
+            checksum += stack.Pipeline().Map(scale).Where(keep).Reduce(add, 0);
+        });
+        out << std::setw(10) << n << std::setw(14) << chainedMs << std::setw(14) << fusedMs
+            << std::setw(14) << chainedMs / fusedMs << std::endl;
+    }
+    out << "(checksum " << checksum << ")" << std::endl << std::endl;
+}
+
+void benchParallelFunctional(std::ostream& out) {
+    out << "=== Parallel Reduce / Map / Where, ms ===" << std::endl;
+    const int n = 1 << 21;
+    Stack<int> stack;
+    stack.Reserve(n);
+    SegmentedDeque<int> deque;
+    for (int i = 0; i < n; ++i) {
+        stack.Push(i % 1000);
+        deque.push_back(i % 1000);
+    }
+    // Достаточно дорогая функция, чтобы проход упирался в вычисления, а не в память
+    auto heavy = [](int x) {
+        unsigned h = static_cast<unsigned>(x);
+        for (int r = 0; r < 16; ++r) {
+            h = h * 2654435761u + 0x9e3779b9u;
+        }
+        return static_cast<int>(h >> 8);
+    };
+    auto add = [](int x, int sum) { return x + sum; };
+    auto keep = [](int x) { return (x & 3) == 0; };
+    long long checksum = 0;
+
+    double stackReduceMs = measureMs([&]() { checksum += stack.Reduce(add, 0); });
+    double stackMapMs = measureMs([&]() { Stack<int>* mapped = stack.Map(heavy); checksum += mapped->Peek(); delete mapped; });
+    double dequeReduceMs = measureMs([&]() {
+        checksum += deque.reduce<int>([](int sum, const int& x) { return sum + x; }, 0);
+    });
+    out << std::fixed << std::setprecision(2);
+    out << "N = " << n << ", sequential: Stack Reduce " << stackReduceMs << ", Stack Map " << stackMapMs
+        << ", deque reduce " << dequeReduceMs << std::endl;
+
+    out << std::setw(10) << "threads" << std::setw(14) << "Reduce" << std::setw(14) << "Map" << std::setw(14) << "Where"
+        << std::setw(14) << "deque reduce" << std::setw(14) << "deque map" << std::setw(14) << "Map speedup" << std::endl;
+    unsigned cores = std::thread::hardware_concurrency();
+    int maxThreads = std::max(4, static_cast<int>(cores));
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        double reduceMs = measureMs([&]() { checksum += stack.ParallelReduce(add, 0, PARALLEL_GRAIN, threads); });
+        double mapMs = measureMs([&]() {
+            Stack<int>* mapped = stack.ParallelMap(heavy, PARALLEL_GRAIN, threads);
+            checksum += mapped->Peek();
+            delete mapped;
+        });
+        double whereMs = measureMs([&]() {
+            Stack<int>* kept = stack.ParallelWhere(keep, PARALLEL_GRAIN, threads);
+            checksum += kept->GetLength();
+            delete kept;
+        });
+        double dequeMs = measureMs([&]() {
+            checksum += deque.parallel_reduce([](int sum, const int& x) { return sum + x; }, 0, PARALLEL_GRAIN, threads);
+        });
+        double dequeMapMs = measureMs([&]() {
+            checksum += deque.parallel_map<int>(heavy, PARALLEL_GRAIN, threads).size();
+        });
+        out << std::setw(10) << threads << std::setw(14) << reduceMs << std::setw(14) << mapMs << std::setw(14) << whereMs
+            << std::setw(14) << dequeMs << std::setw(14) << dequeMapMs << std::setw(14) << stackMapMs / mapMs << std::endl;
+    }
+
+    // Мелкие куски - лучше баланс, но больше накладных расходов на буферы кусков
+    out << std::setw(10) << "grain" << std::setw(14) << "Reduce" << std::setw(14) << "Map" << std::endl;
+    for (int grain = 1 << 10; grain <= (1 << 20); grain *= 4) {
+        double reduceMs = measureMs([&]() { checksum += stack.ParallelReduce(add, 0, grain); });
+        double mapMs = measureMs([&]() {
+            Stack<int>* mapped = stack.ParallelMap(heavy, grain);
+            checksum += mapped->Peek();
+            delete mapped;
+        });
+        out << std::setw(10) << grain << std::setw(14) << reduceMs << std::setw(14) << mapMs << std::endl;
+    }
+    out << "(checksum " << checksum << ")" << std::endl << std::endl;
+}
+
+void runBenchmarks() {
+    std::ofstream outFile("outputBench.txt");
+    if (!outFile) {
+        std::cerr << "Не удалось открыть файл outputBench.txt для записи" << std::endl;
+        return;
+    }
+
+    benchArrayAppend(outFile);
+    benchHeavyElements(outFile);
+    benchListChurn(outFile);
+    benchUnrolledList(outFile);
+    benchImmutableAppend(outFile);
+    benchImmutableList(outFile);
+    benchCloneRead(outFile);
+    benchWindows(outFile);
+    benchRanges(outFile);
+    benchStaticDispatch(outFile);
+    benchLinearForm(outFile);
+    benchBatchEvaluate(outFile);
+    benchPolynomial(outFile);
+    benchFormExpressions(outFile);
+    benchSparseLinearForm(outFile);
+    benchStackPushPop(outFile);
+    benchConcurrentStack(outFile);
+    benchEliminationStack(outFile);
+    benchStackPipeline(outFile);
+    benchParallelFunctional(outFile);
+
+    outFile.close();
+    std::cout << "Бенчмарки завершены. Результаты записаны в outputBench.txt" << std::endl;
+}
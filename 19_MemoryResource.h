@@ -0,0 +1,322 @@
+#ifndef MEMORY_RESOURCE_H
+#define MEMORY_RESOURCE_H
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Источник памяти для контейнеров. Контейнер получает указатель на ресурс
+// в конструкторе и берёт через него все узлы и буферы.
+class MemoryResource {
+public:
+    virtual ~MemoryResource() = default;
+
+    virtual void* Allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) = 0;
+    virtual void Deallocate(void* memory, std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) = 0;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// Обычные ::operator new / ::operator delete; выравнивание больше, чем даёт
+// простой operator new, - через их варианты с std::align_val_t
+class NewDeleteResource : public MemoryResource {
+public:
+    void* Allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) override {
+        if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            return ::operator new(bytes, std::align_val_t(alignment));
+        }
+        return ::operator new(bytes);
+    }
+
+    void Deallocate(void* memory, std::size_t, std::size_t alignment = alignof(std::max_align_t)) override {
+        if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            ::operator delete(memory, std::align_val_t(alignment));
+            return;
+        }
+        ::operator delete(memory);
+    }
+};
+
+inline MemoryResource* DefaultResource() {
+    static NewDeleteResource resource;
+    return &resource;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// Монотонная арена: выделение - сдвиг указателя, Deallocate ничего не делает,
+// вся память освобождается разом в Release() или в деструкторе.
+// Не потокобезопасна - одна арена на поток.
+class MonotonicArena : public MemoryResource {
+public:
+    explicit MonotonicArena(std::size_t initialBlockSize = 4096, MemoryResource* upstream = DefaultResource())
+        : upstream(upstream), blocks(nullptr), current(nullptr), remaining(0),
+          nextBlockSize(initialBlockSize > 0 ? initialBlockSize : 4096), bytesAllocated(0) {}
+
+    MonotonicArena(const MonotonicArena&) = delete;
+    MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+    ~MonotonicArena() override {
+        Release();
+    }
+
+    void* Allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) override {
+        std::size_t padding = Padding(current, alignment);
+        if (current == nullptr || padding + bytes > remaining) {
+            AddBlock(bytes + alignment);
+            padding = Padding(current, alignment);
+        }
+        char* result = current + padding;
+        current = result + bytes;
+        remaining -= padding + bytes;
+        bytesAllocated += bytes;
+        return result;
+    }
+
+    void Deallocate(void*, std::size_t, std::size_t = alignof(std::max_align_t)) override {}
+
+    // Возвращает все блоки вышестоящему ресурсу за O(число блоков)
+    void Release() {
+        while (blocks != nullptr) {
+            Block* next = blocks->next;
+            upstream->Deallocate(blocks, blocks->size);
+            blocks = next;
+        }
+        current = nullptr;
+        remaining = 0;
+        bytesAllocated = 0;
+    }
+
+    std::size_t BytesAllocated() const { return bytesAllocated; }
+
+private:
+    struct Block {
+        Block* next;
+        std::size_t size;
+    };
+
+    MemoryResource* upstream;
+    Block* blocks;
+    char* current;
+    std::size_t remaining;
+    std::size_t nextBlockSize;
+    std::size_t bytesAllocated;
+
+    static std::size_t Padding(const char* pointer, std::size_t alignment) {
+        std::size_t address = reinterpret_cast<std::size_t>(pointer);
+        return (alignment - address % alignment) % alignment;
+    }
+
+    void AddBlock(std::size_t minimumBytes) {
+        std::size_t size = nextBlockSize;
+        while (size < minimumBytes + sizeof(Block)) {
+            size *= 2;
+        }
+        Block* block = static_cast<Block*>(upstream->Allocate(size));
+        block->next = blocks;
+        block->size = size;
+        blocks = block;
+        current = reinterpret_cast<char*>(block) + sizeof(Block);
+        remaining = size - sizeof(Block);
+        nextBlockSize = size * 2;
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// Пул блоков одного размера со списком свободных. Память берётся пачками (slab)
+// у вышестоящего ресурса; запросы крупнее blockSize уходят туда напрямую.
+// Каждая следующая пачка вдвое больше предыдущей, пока не достигнет maxBlocksPerSlab.
+// Не потокобезопасен.
+class NodePool : public MemoryResource {
+public:
+    explicit NodePool(std::size_t blockSize, std::size_t blocksPerSlab = 64, MemoryResource* upstream = DefaultResource(),
+                      std::size_t maxBlocksPerSlab = 0)
+        : upstream(upstream), slabs(nullptr), freeList(nullptr),
+          blockSize(RoundUp(blockSize < sizeof(FreeNode) ? sizeof(FreeNode) : blockSize)),
+          blocksPerSlab(blocksPerSlab > 0 ? blocksPerSlab : 64),
+          maxBlocksPerSlab(maxBlocksPerSlab > this->blocksPerSlab ? maxBlocksPerSlab : this->blocksPerSlab) {}
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    ~NodePool() override {
+        Release();
+    }
+
+    void* Allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) override {
+        if (bytes > blockSize || alignment > alignof(std::max_align_t)) {
+            return upstream->Allocate(bytes, alignment);
+        }
+        if (freeList == nullptr) {
+            AddSlab();
+        }
+        FreeNode* node = freeList;
+        freeList = node->next;
+        return node;
+    }
+
+    void Deallocate(void* memory, std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) override {
+        if (memory == nullptr) return;
+        if (bytes > blockSize || alignment > alignof(std::max_align_t)) {
+            upstream->Deallocate(memory, bytes, alignment);
+            return;
+        }
+        FreeNode* node = static_cast<FreeNode*>(memory);
+        node->next = freeList;
+        freeList = node;
+    }
+
+    void Release() {
+        while (slabs != nullptr) {
+            Slab* next = slabs->next;
+            upstream->Deallocate(slabs, slabs->size);
+            slabs = next;
+        }
+        freeList = nullptr;
+    }
+
+    std::size_t BlockSize() const { return blockSize; }
+
+private:
+    struct FreeNode {
+        FreeNode* next;
+    };
+
+    struct Slab {
+        Slab* next;
+        std::size_t size;
+    };
+
+    MemoryResource* upstream;
+    Slab* slabs;
+    FreeNode* freeList;
+    std::size_t blockSize;
+    std::size_t blocksPerSlab;
+    std::size_t maxBlocksPerSlab;
+
+    static std::size_t RoundUp(std::size_t bytes) {
+        std::size_t alignment = alignof(std::max_align_t);
+        return (bytes + alignment - 1) / alignment * alignment;
+    }
+
+    void AddSlab() {
+        std::size_t header = RoundUp(sizeof(Slab));
+        std::size_t size = header + blockSize * blocksPerSlab;
+        Slab* slab = static_cast<Slab*>(upstream->Allocate(size));
+        slab->next = slabs;
+        slab->size = size;
+        slabs = slab;
+
+        char* first = reinterpret_cast<char*>(slab) + header;
+        for (std::size_t i = blocksPerSlab; i > 0; --i) {
+            FreeNode* node = reinterpret_cast<FreeNode*>(first + (i - 1) * blockSize);
+            node->next = freeList;
+            freeList = node;
+        }
+
+        if (blocksPerSlab < maxBlocksPerSlab) {
+            blocksPerSlab = (blocksPerSlab * 2 < maxBlocksPerSlab) ? blocksPerSlab * 2 : maxBlocksPerSlab;
+        }
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// Небольшой буфер внутри объекта-владельца (small-buffer optimization для любого контейнера).
+// Первое подходящее по размеру выделение берётся из буфера, остальные и крупные - у вышестоящего
+// ресурса; после Deallocate буфер снова свободен. Как и арена, ресурс должен жить дольше
+// контейнеров на нём, поэтому его не копируют и не перемещают. Не потокобезопасен.
+template <std::size_t Bytes>
+class InlineResource : public MemoryResource {
+    static_assert(Bytes > 0, "Inline buffer cannot be empty");
+
+public:
+    explicit InlineResource(MemoryResource* upstream = DefaultResource()) : upstream(upstream), used(false) {}
+
+    InlineResource(const InlineResource&) = delete;
+    InlineResource& operator=(const InlineResource&) = delete;
+
+    void* Allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) override {
+        if (!used && bytes <= Bytes && alignment <= alignof(std::max_align_t)) {
+            used = true;
+            return storage;
+        }
+        return upstream->Allocate(bytes, alignment);
+    }
+
+    void Deallocate(void* memory, std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) override {
+        if (memory == storage) {
+            used = false;
+            return;
+        }
+        upstream->Deallocate(memory, bytes, alignment);
+    }
+
+    bool InUse() const { return used; }
+
+private:
+    MemoryResource* upstream;
+    bool used;
+    alignas(std::max_align_t) unsigned char storage[Bytes];
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template <class U, class... Args>
+U* NewObject(MemoryResource* resource, Args&&... args) {
+    void* memory = resource->Allocate(sizeof(U), alignof(U));
+    try {
+        return new (memory) U(std::forward<Args>(args)...);
+    } catch (...) {
+        resource->Deallocate(memory, sizeof(U), alignof(U));
+        throw;
+    }
+}
+
+template <class U>
+void DeleteObject(MemoryResource* resource, U* object) {
+    if (object == nullptr) return;
+    object->~U();
+    resource->Deallocate(object, sizeof(U), alignof(U));
+}
+
+// Аллокатор для стандартных контейнеров поверх MemoryResource
+template <class T>
+class ResourceAllocator {
+public:
+    typedef T value_type;
+    typedef std::true_type propagate_on_container_move_assignment;
+    typedef std::true_type propagate_on_container_swap;
+
+    ResourceAllocator(MemoryResource* resource = DefaultResource()) : resource(resource) {}
+
+    template <class U>
+    ResourceAllocator(const ResourceAllocator<U>& other) : resource(other.GetResource()) {}
+
+    T* allocate(std::size_t count) {
+        return static_cast<T*>(resource->Allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* memory, std::size_t count) {
+        resource->Deallocate(memory, count * sizeof(T), alignof(T));
+    }
+
+    MemoryResource* GetResource() const { return resource; }
+
+private:
+    MemoryResource* resource;
+};
+
+template <class T, class U>
+bool operator==(const ResourceAllocator<T>& a, const ResourceAllocator<U>& b) {
+    return a.GetResource() == b.GetResource();
+}
+
+template <class T, class U>
+bool operator!=(const ResourceAllocator<T>& a, const ResourceAllocator<U>& b) {
+    return !(a == b);
+}
+
+#endif
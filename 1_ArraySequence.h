@@ -3,6 +3,8 @@
 
 #include "0_Sequence.h"
 #include "3_DynamicArray.h"
+#include "27_PersistentVector.h"
+#include "31_SequenceView.h"
 
 template <class T> class ArraySequence;
 template <class T> class MutableArraySequence;
@@ -12,18 +14,82 @@ template <class T> class ImmutableArraySequence;
 template <class T> class ArraySequence: public Sequence<T>
     {
         public:
+            // Идёт по кускам, лежащим в памяти подряд: у MutableArraySequence кусок один - весь буфер,
+            // у ImmutableArraySequence - листья персистентного вектора. Внутри куска шаг - сдвиг указателя
+            class ConstIterator
+                {
+                    public:
+                        typedef std::forward_iterator_tag iterator_category;
+                        typedef T value_type;
+                        typedef std::ptrdiff_t difference_type;
+                        typedef const T* pointer;
+                        typedef const T& reference;
+
+                        ConstIterator(const ArraySequence<T>* sequence, int index)
+                            : sequence(sequence), index(index), item(nullptr), chunkEnd(nullptr) { Load(); }
+
+                        const T& operator*() const { return *item; }
+                        const T* operator->() const { return item; }
+                        ConstIterator& operator++() {
+                            ++index;
+                            if (++item == chunkEnd) Load();
+                            return *this;
+                        }
+                        ConstIterator operator++(int) { ConstIterator old = *this; ++*this; return old; }
+                        // Сдвиг вперёд на steps: внутри куска - указатель, иначе новый поиск куска
+                        ConstIterator& Skip(int steps) {
+                            index += steps;
+                            if (steps < chunkEnd - item) item += steps;
+                            else Load();
+                            return *this;
+                        }
+                        bool operator==(const ConstIterator& other) const { return index == other.index && sequence == other.sequence; }
+                        bool operator!=(const ConstIterator& other) const { return !(*this == other); }
+
+                    private:
+                        const ArraySequence<T>* sequence;
+                        int index;
+                        const T* item;
+                        const T* chunkEnd;
+
+                        void Load() {
+                            int count = 0;
+                            item = index < sequence->GetLength() ? sequence->Chunk(index, count) : nullptr;
+                            chunkEnd = item + count;
+                        }
+                };
+
             ArraySequence(T* items, int count);
             ArraySequence();
+            explicit ArraySequence(MemoryResource* resource);
             ArraySequence(const DynamicArray<T>& arr);
+            ArraySequence(DynamicArray<T>&& arr) noexcept;
+            template <class InputIt, class = typename std::iterator_traits<InputIt>::iterator_category>
+            ArraySequence(InputIt first, InputIt last, MemoryResource* resource = DefaultResource());
             ArraySequence(const ArraySequence& other);
+            ArraySequence(ArraySequence&& other) noexcept;
 
             virtual ~ArraySequence();
 
+            ArraySequence& operator= (const ArraySequence& other);
+            ArraySequence& operator= (ArraySequence&& other) noexcept;
+
             T GetFirst() const override;
             T GetLast() const override;
             T Get(int index) const override;
             int GetLength() const override;
+            int Capacity() const;
+            MemoryResource* GetResource() const;
             ArraySequence<T>* GetSubsequence(int startIndex, int endIndex) const override;
+            // Срез без копирования: делит буфер с последовательностью
+            virtual SequenceView<T> GetSubsequenceView(int startIndex, int endIndex) const;
+
+            void Reserve(int capacity);
+            void ShrinkToFit();
+
+            // Итераторы только для чтения (у ImmutableArraySequence менять элементы нельзя)
+            ConstIterator begin() const;
+            ConstIterator end() const;
 
             virtual ArraySequence<T>* Instance() = 0;
             virtual ArraySequence<T>* Clone() const = 0;
@@ -33,13 +99,27 @@ template <class T> class ArraySequence: public Sequence<T>
             ArraySequence<T>* InsertAt(T item, int index) override;
             ArraySequence<T>* Concat(Sequence<T>* other) override;
             std::string ToString() const;
+
+            template <class... Args> ArraySequence<T>* Emplace(int index, Args&&... args);
+            template <class... Args> ArraySequence<T>* EmplaceBack(Args&&... args);
+
+            // Вставка диапазона за одно расширение хранилища
+            template <class InputIt> ArraySequence<T>* AppendRange(InputIt first, InputIt last);
+            template <class InputIt> ArraySequence<T>* PrependRange(InputIt first, InputIt last);
+            template <class InputIt> ArraySequence<T>* InsertRange(int index, InputIt first, InputIt last);
             
         protected:
-            DynamicArray<T>* items;
-
-            void AppendImpl(T item);
-            void PrependImpl(T item);
-            void InsertAtImpl(T item, int index);
+            DynamicArray<T> items;
+
+            virtual void AppendImpl(T item);
+            virtual void PrependImpl(T item);
+            virtual void InsertAtImpl(T item, int index);
+            // Вставка уже собранных элементов, их можно забрать перемещением
+            virtual void InsertRangeImpl(int index, DynamicArray<T>& elements);
+            // Элементы, лежащие подряд начиная с index: указатель на первый, в count - их число
+            virtual const T* Chunk(int index, int& count) const;
+            // Хранилище, в котором Emplace может конструировать на месте; nullptr, если элементы лежат не в items
+            virtual DynamicArray<T>* Storage();
     };
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -48,144 +128,283 @@ template <class T> class MutableArraySequence : public ArraySequence<T>
     {
         public:
             MutableArraySequence();
+            explicit MutableArraySequence(MemoryResource* resource);
             MutableArraySequence(T* items, int count);
             MutableArraySequence(const DynamicArray<T>& arr);
+            MutableArraySequence(DynamicArray<T>&& arr) noexcept;
+            template <class InputIt, class = typename std::iterator_traits<InputIt>::iterator_category>
+            MutableArraySequence(InputIt first, InputIt last, MemoryResource* resource = DefaultResource());
             MutableArraySequence(const MutableArraySequence& other);
+            MutableArraySequence(MutableArraySequence&& other) noexcept;
+            MutableArraySequence& operator= (const MutableArraySequence& other) = default;
+            MutableArraySequence& operator= (MutableArraySequence&& other) noexcept = default;
             ArraySequence<T>* Instance() override;
             ArraySequence<T>* Clone() const override;
+
+            // Элементы лежат одним буфером, поэтому итераторы - просто указатели
+            const T* begin() const;
+            const T* end() const;
     };
 
 template <class T> class ImmutableArraySequence : public ArraySequence<T> 
     {
         public:
             ImmutableArraySequence();
+            explicit ImmutableArraySequence(MemoryResource* resource);
             ImmutableArraySequence(T* items, int count);
             ImmutableArraySequence(const DynamicArray<T>& arr);
+            ImmutableArraySequence(const PersistentVector<T>& elements);
+            template <class InputIt, class = typename std::iterator_traits<InputIt>::iterator_category>
+            ImmutableArraySequence(InputIt first, InputIt last, MemoryResource* resource = DefaultResource());
+            ImmutableArraySequence(const ImmutableArraySequence& other);
+            ImmutableArraySequence(ImmutableArraySequence&& other) noexcept;
+
+            T GetFirst() const override;
+            T GetLast() const override;
+            T Get(int index) const override;
+            int GetLength() const override;
+            ArraySequence<T>* GetSubsequence(int startIndex, int endIndex) const override;
+            // Срез держит свою копию персистентного вектора: узлы общие, элементы не копируются
+            SequenceView<T> GetSubsequenceView(int startIndex, int endIndex) const override;
+            std::string ToString() const override;
+
             ArraySequence<T>* Instance() override;
             ArraySequence<T>* Clone() const override;
+
+        protected:
+            void AppendImpl(T item) override;
+            void PrependImpl(T item) override;
+            void InsertAtImpl(T item, int index) override;
+            void InsertRangeImpl(int index, DynamicArray<T>& elements) override;
+            const T* Chunk(int index, int& count) const override;
+            DynamicArray<T>* Storage() override;
+
+        private:
+            // Элементы лежат в персистентном векторе, унаследованный items не используется.
+            // Instance() копирует только корень, Append меняет O(log32 n) узлов
+            PersistentVector<T> vector;
     };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 
 template <class T>
-ArraySequence<T>::ArraySequence(T* items, int count) : items(new DynamicArray<T>(items, count)) {}
+ArraySequence<T>::ArraySequence(T* items, int count) : items(items, count) {}
 
 template <class T>
-ArraySequence<T>::ArraySequence() : items(new DynamicArray<T>(0)) {}
+ArraySequence<T>::ArraySequence() : items(0) {}
 
 template <class T>
-ArraySequence<T>::ArraySequence(const DynamicArray<T>& arr) : items(new DynamicArray<T>(arr)) {}
+ArraySequence<T>::ArraySequence(MemoryResource* resource) : items(0, resource) {}
 
 template <class T>
-ArraySequence<T>::ArraySequence(const ArraySequence& other) : items(new DynamicArray<T>(*other.items)) {}
+ArraySequence<T>::ArraySequence(const DynamicArray<T>& arr) : items(arr) {}
 
 template <class T>
-ArraySequence<T>::~ArraySequence() { delete items; }
+ArraySequence<T>::ArraySequence(DynamicArray<T>&& arr) noexcept : items(std::move(arr)) {}
+
+template <class T> template <class InputIt, class>
+ArraySequence<T>::ArraySequence(InputIt first, InputIt last, MemoryResource* resource) : items(first, last, resource) {}
+
+template <class T>
+ArraySequence<T>::ArraySequence(const ArraySequence& other) : items(other.items) {}
+
+template <class T>
+ArraySequence<T>::ArraySequence(ArraySequence&& other) noexcept : items(std::move(other.items)) {}
+
+template <class T>
+ArraySequence<T>::~ArraySequence() {}
+
+template <class T>
+ArraySequence<T>& ArraySequence<T>::operator=(const ArraySequence& other) {
+    items = other.items;
+    return *this;
+}
+
+template <class T>
+ArraySequence<T>& ArraySequence<T>::operator=(ArraySequence&& other) noexcept {
+    items = std::move(other.items);
+    return *this;
+}
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 template <class T> T ArraySequence<T>::GetFirst() const {
-    if (items->GetSize() == 0) throw std::out_of_range("Sequence is empty");
-    return items->Get(0);
+    if (items.GetSize() == 0) throw std::out_of_range("Sequence is empty");
+    return items.Get(0);
 }
 
 template <class T> T ArraySequence<T>::GetLast() const {
-    if (items->GetSize() == 0) throw std::out_of_range("Sequence is empty");
-    return items->Get(items->GetSize() - 1);
+    if (items.GetSize() == 0) throw std::out_of_range("Sequence is empty");
+    return items.Get(items.GetSize() - 1);
 }
 
 template <class T> T ArraySequence<T>::Get(int index) const {
-    return items->Get(index);
+    return items.Get(index);
 }
 
 template <class T> int ArraySequence<T>::GetLength() const {
-    return items->GetSize();
+    return items.GetSize();
+}
+
+template <class T> int ArraySequence<T>::Capacity() const {
+    return items.Capacity();
+}
+
+template <class T> MemoryResource* ArraySequence<T>::GetResource() const {
+    return items.GetResource();
+}
+
+template <class T> void ArraySequence<T>::Reserve(int capacity) {
+    items.Reserve(capacity);
+}
+
+template <class T> void ArraySequence<T>::ShrinkToFit() {
+    items.ShrinkToFit();
+}
+
+template <class T> const T* ArraySequence<T>::Chunk(int index, int& count) const {
+    count = items.GetSize() - index;
+    return items.Data() + index;
+}
+
+template <class T> DynamicArray<T>* ArraySequence<T>::Storage() {
+    return &items;
+}
+
+template <class T> typename ArraySequence<T>::ConstIterator ArraySequence<T>::begin() const {
+    return ConstIterator(this, 0);
+}
+
+template <class T> typename ArraySequence<T>::ConstIterator ArraySequence<T>::end() const {
+    return ConstIterator(this, GetLength());
 }
 
 template <class T> ArraySequence<T>* ArraySequence<T>::GetSubsequence(int startIndex, int endIndex) const {
-    if (startIndex < 0 || endIndex >= items->GetSize() || startIndex > endIndex) {
+    if (startIndex < 0 || endIndex >= GetLength() || startIndex > endIndex) {
         throw std::out_of_range("Invalid subsequence range");
     }
 
-    int subSize = endIndex - startIndex + 1;
-    T* subItems = new T[subSize];
-    for (int i = 0; i < subSize; i++) {
-        subItems[i] = items->Get(startIndex + i);
-    }
+    DynamicArray<T> result(0, items.GetResource());
+    result.InsertN(0, ConstIterator(this, startIndex), endIndex - startIndex + 1);
+    return new MutableArraySequence<T>(std::move(result));
+}
 
-    ArraySequence<T>* result = new MutableArraySequence<T>(subItems, subSize); // ! (можгно спрятать внутрь)
-    delete[] subItems;
-    return result;
+template <class T> SequenceView<T> ArraySequence<T>::GetSubsequenceView(int startIndex, int endIndex) const {
+    if (startIndex < 0 || endIndex >= GetLength() || startIndex > endIndex) {
+        throw std::out_of_range("Invalid subsequence range");
+    }
+    return SequenceView<T>(items, startIndex, endIndex - startIndex + 1);
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////
 
 template <class T> void ArraySequence<T>::AppendImpl(T item) {
-    items->Resize(items->GetSize() + 1);
-    items->Set(items->GetSize() - 1, item);
+    items.EmplaceBack(std::move(item));
 }
 
 template <class T> void ArraySequence<T>::PrependImpl(T item) {
-    items->Resize(items->GetSize() + 1);
-    for (int i = items->GetSize() - 1; i > 0; i--) {
-        items->Set(i, items->Get(i - 1));
-    }
-    items->Set(0, item);
+    items.Emplace(0, std::move(item));
 }
 
 template <class T> void ArraySequence<T>::InsertAtImpl(T item, int index) {
-    if (index < 0 || index > items->GetSize()) {
-        throw std::out_of_range("Index out of range");
-    }
-    items->Resize(items->GetSize() + 1);
-    for (int i = items->GetSize() - 1; i > index; i--) {
-        items->Set(i, items->Get(i - 1));
-    }
-    items->Set(index, item);
+    items.Emplace(index, std::move(item));
+}
+
+template <class T> void ArraySequence<T>::InsertRangeImpl(int index, DynamicArray<T>& elements) {
+    items.InsertN(index, std::make_move_iterator(elements.begin()), elements.GetSize());
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
 template <class T> ArraySequence<T>* ArraySequence<T>::Append(T item)  {
     ArraySequence<T>* newseq = Instance();
-    newseq->AppendImpl(item);
+    newseq->AppendImpl(std::move(item));
     return newseq;
 }
 
 template <class T> ArraySequence<T>* ArraySequence<T>::Prepend(T item) {
     ArraySequence<T>* newseq = Instance();
-    newseq->PrependImpl(item);
+    newseq->PrependImpl(std::move(item));
     return newseq;
 }
 
 template <class T> ArraySequence<T>* ArraySequence<T>::InsertAt(T item, int index) {
     ArraySequence<T>* newseq = Instance();
-    newseq->InsertAtImpl(item, index);
+    newseq->InsertAtImpl(std::move(item), index);
+    return newseq;
+}
+
+template <class T> template <class... Args> ArraySequence<T>* ArraySequence<T>::Emplace(int index, Args&&... args) {
+    ArraySequence<T>* newseq = Instance();
+    if (DynamicArray<T>* storage = newseq->Storage()) {
+        storage->Emplace(index, std::forward<Args>(args)...);
+    }
+    else {
+        newseq->InsertAtImpl(T(std::forward<Args>(args)...), index);
+    }
+    return newseq;
+}
+
+template <class T> template <class... Args> ArraySequence<T>* ArraySequence<T>::EmplaceBack(Args&&... args) {
+    ArraySequence<T>* newseq = Instance();
+    if (DynamicArray<T>* storage = newseq->Storage()) {
+        storage->EmplaceBack(std::forward<Args>(args)...);
+    }
+    else {
+        newseq->AppendImpl(T(std::forward<Args>(args)...));
+    }
+    return newseq;
+}
+
+template <class T> template <class InputIt> ArraySequence<T>* ArraySequence<T>::AppendRange(InputIt first, InputIt last) {
+    return InsertRange(GetLength(), first, last);
+}
+
+template <class T> template <class InputIt> ArraySequence<T>* ArraySequence<T>::PrependRange(InputIt first, InputIt last) {
+    return InsertRange(0, first, last);
+}
+
+template <class T> template <class InputIt> ArraySequence<T>* ArraySequence<T>::InsertRange(int index, InputIt first, InputIt last) {
+    if (index < 0 || index > GetLength()) {
+        throw std::out_of_range("Index out of range");
+    }
+
+    ArraySequence<T>* newseq = Instance();
+    try {
+        if (DynamicArray<T>* storage = newseq->Storage()) {
+            storage->InsertRange(index, first, last);
+        }
+        else {
+            DynamicArray<T> elements(first, last, items.GetResource());
+            newseq->InsertRangeImpl(index, elements);
+        }
+    } catch (...) {
+        if (newseq != this) delete newseq;
+        throw;
+    }
     return newseq;
 }
 
 template <class T> ArraySequence<T>* ArraySequence<T>::Concat(Sequence<T>* other) {
     if (!other) throw std::invalid_argument("Other sequence cannot be null");
-    
-    int totalSize = this->GetLength() + other->GetLength();
-    T* newItems = new T[totalSize];
-    
-    for (int i = 0; i < this->GetLength(); i++) {
-        newItems[i] = this->Get(i);
+
+    DynamicArray<T> result(0, items.GetResource());
+    result.Reserve(this->GetLength() + other->GetLength());
+    result.InsertN(0, begin(), GetLength());
+
+    // Массив копируем по кускам, остальные последовательности - общим итератором
+    if (const ArraySequence<T>* array = dynamic_cast<const ArraySequence<T>*>(other)) {
+        result.InsertN(result.GetSize(), array->begin(), array->GetLength());
     }
-    
-    for (int i = 0; i < other->GetLength(); i++) {
-        newItems[this->GetLength() + i] = other->Get(i);
+    else {
+        result.InsertN(result.GetSize(), other->begin(), other->GetLength());
     }
-    
-    ArraySequence<T>* result = new MutableArraySequence<T>(newItems, totalSize);
-    delete[] newItems;
-    
-    return result;
+
+    return new MutableArraySequence<T>(std::move(result));
 }
 
 template <class T> std::string ArraySequence<T>::ToString() const {
-    return items->ToString();
+    return items.ToString();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -193,40 +412,142 @@ template <class T> std::string ArraySequence<T>::ToString() const {
 template <class T> MutableArraySequence<T>::MutableArraySequence() 
     : ArraySequence<T>() {}
 
+template <class T> MutableArraySequence<T>::MutableArraySequence(MemoryResource* resource) 
+    : ArraySequence<T>(resource) {}
+
 template <class T> MutableArraySequence<T>::MutableArraySequence(T* items, int count) 
     : ArraySequence<T>(items, count) {}
 
 template <class T> MutableArraySequence<T>::MutableArraySequence(const DynamicArray<T>& arr) 
     : ArraySequence<T>(arr) {}
 
+template <class T> MutableArraySequence<T>::MutableArraySequence(DynamicArray<T>&& arr) noexcept
+    : ArraySequence<T>(std::move(arr)) {}
+
+template <class T> template <class InputIt, class>
+MutableArraySequence<T>::MutableArraySequence(InputIt first, InputIt last, MemoryResource* resource)
+    : ArraySequence<T>(first, last, resource) {}
+
 template <class T> MutableArraySequence<T>::MutableArraySequence(const MutableArraySequence& other) 
     : ArraySequence<T>(other) {}
 
+template <class T> MutableArraySequence<T>::MutableArraySequence(MutableArraySequence&& other) noexcept
+    : ArraySequence<T>(std::move(other)) {}
+
 template <class T> ArraySequence<T>* MutableArraySequence<T>::Instance() {
     return this;
 }
 
 template <class T> ArraySequence<T>* MutableArraySequence<T>::Clone() const {
-    return new MutableArraySequence<T>(*this->items);
+    return new MutableArraySequence<T>(this->items);
+}
+
+template <class T> const T* MutableArraySequence<T>::begin() const {
+    return this->items.Data();
+}
+
+template <class T> const T* MutableArraySequence<T>::end() const {
+    return this->items.Data() + this->items.GetSize();
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 template <class T> ImmutableArraySequence<T>::ImmutableArraySequence() 
-    : ArraySequence<T>() {}
+    : ArraySequence<T>(), vector() {}
+
+template <class T> ImmutableArraySequence<T>::ImmutableArraySequence(MemoryResource* resource) 
+    : ArraySequence<T>(resource), vector(resource) {}
 
 template <class T> ImmutableArraySequence<T>::ImmutableArraySequence(T* items, int count) 
-    : ArraySequence<T>(items, count) {}
+    : ArraySequence<T>(), vector(items, count) {}
 
 template <class T> ImmutableArraySequence<T>::ImmutableArraySequence(const DynamicArray<T>& arr) 
-    : ArraySequence<T>(arr) {}
+    : ArraySequence<T>(arr.GetResource()), vector(arr.Data(), arr.GetSize(), arr.GetResource()) {}
+
+template <class T> ImmutableArraySequence<T>::ImmutableArraySequence(const PersistentVector<T>& elements) 
+    : ArraySequence<T>(elements.GetResource()), vector(elements) {}
+
+template <class T> template <class InputIt, class>
+ImmutableArraySequence<T>::ImmutableArraySequence(InputIt first, InputIt last, MemoryResource* resource)
+    : ArraySequence<T>(resource), vector(resource) {
+    vector.InsertRange(0, first, last);
+}
+
+template <class T> ImmutableArraySequence<T>::ImmutableArraySequence(const ImmutableArraySequence& other) 
+    : ImmutableArraySequence(other.vector) {}
+
+template <class T> ImmutableArraySequence<T>::ImmutableArraySequence(ImmutableArraySequence&& other) noexcept
+    : ArraySequence<T>(std::move(other)), vector(std::move(other.vector)) {}
+
+template <class T> T ImmutableArraySequence<T>::GetFirst() const {
+    if (vector.GetSize() == 0) throw std::out_of_range("Sequence is empty");
+    return vector.Get(0);
+}
+
+template <class T> T ImmutableArraySequence<T>::GetLast() const {
+    if (vector.GetSize() == 0) throw std::out_of_range("Sequence is empty");
+    return vector.Get(vector.GetSize() - 1);
+}
+
+template <class T> T ImmutableArraySequence<T>::Get(int index) const {
+    return vector.Get(index);
+}
+
+template <class T> int ImmutableArraySequence<T>::GetLength() const {
+    return vector.GetSize();
+}
+
+template <class T> ArraySequence<T>* ImmutableArraySequence<T>::GetSubsequence(int startIndex, int endIndex) const {
+    if (startIndex < 0 || endIndex >= vector.GetSize() || startIndex > endIndex) {
+        throw std::out_of_range("Invalid subsequence range");
+    }
+
+    DynamicArray<T> result(0, vector.GetResource());
+    result.InsertN(0, typename ArraySequence<T>::ConstIterator(this, startIndex), endIndex - startIndex + 1);
+    return new MutableArraySequence<T>(std::move(result));
+}
+
+template <class T> SequenceView<T> ImmutableArraySequence<T>::GetSubsequenceView(int startIndex, int endIndex) const {
+    if (startIndex < 0 || endIndex >= vector.GetSize() || startIndex > endIndex) {
+        throw std::out_of_range("Invalid subsequence range");
+    }
+    return SequenceView<T>(vector, startIndex, endIndex - startIndex + 1);
+}
+
+template <class T> std::string ImmutableArraySequence<T>::ToString() const {
+    return vector.ToString();
+}
+
+template <class T> void ImmutableArraySequence<T>::AppendImpl(T item) {
+    vector.PushBack(std::move(item));
+}
+
+template <class T> void ImmutableArraySequence<T>::PrependImpl(T item) {
+    vector.InsertAt(0, std::move(item));
+}
+
+template <class T> void ImmutableArraySequence<T>::InsertAtImpl(T item, int index) {
+    vector.InsertAt(index, std::move(item));
+}
+
+template <class T> void ImmutableArraySequence<T>::InsertRangeImpl(int index, DynamicArray<T>& elements) {
+    vector.InsertRange(index, std::make_move_iterator(elements.begin()), std::make_move_iterator(elements.end()));
+}
+
+template <class T> const T* ImmutableArraySequence<T>::Chunk(int index, int& count) const {
+    return vector.Chunk(index, count);
+}
+
+template <class T> DynamicArray<T>* ImmutableArraySequence<T>::Storage() {
+    return nullptr;
+}
 
 template <class T> ArraySequence<T>* ImmutableArraySequence<T>::Instance() {
     return this->Clone();
 }
 
 template <class T> ArraySequence<T>* ImmutableArraySequence<T>::Clone() const {
-    return new ImmutableArraySequence<T>(*this->items);
+    return new ImmutableArraySequence<T>(vector);
 }
 
 #endif
\ No newline at end of file
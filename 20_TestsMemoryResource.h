@@ -0,0 +1,210 @@
+#include "19_MemoryResource.h"
+#include "1_ArraySequence.h"
+#include "2_ListSequence.h"
+#include "8_SegmentedDeque.h"
+#include "9_BinaryTree.h"
+#include "10_SkipList.h"
+#include "5_Linearform.h"
+#include <iostream>
+#include <fstream>
+#include <cassert>
+
+// Ресурс-счётчик: проверяет, что контейнер возвращает всё, что взял
+class CountingResource : public MemoryResource {
+public:
+    long allocations = 0;
+    long deallocations = 0;
+    long bytesInUse = 0;
+
+    void* Allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) override {
+        allocations++;
+        bytesInUse += static_cast<long>(bytes);
+        return DefaultResource()->Allocate(bytes, alignment);
+    }
+
+    void Deallocate(void* memory, std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) override {
+        deallocations++;
+        bytesInUse -= static_cast<long>(bytes);
+        DefaultResource()->Deallocate(memory, bytes, alignment);
+    }
+};
+
+void testMemoryResource() {
+    std::ofstream outFile("outputMemory.txt");
+    if (!outFile) {
+        std::cerr << "Не удалось открыть файл outputMemory.txt для записи" << std::endl;
+        return;
+    }
+
+    outFile << "=== Starting MemoryResource tests ===" << std::endl;
+
+    // Тест 1: Все контейнеры берут память через переданный ресурс
+    outFile << "\nTest 1: Containers use the given resource...";
+    CountingResource counter;
+    {
+        DynamicArray<int> arr(100, &counter);
+        LinkedList<int> list(&counter);
+        MutableListSequence<int> listSeq(&counter);
+        MutableArraySequence<int> arraySeq(&counter);
+        BinaryTree<int> tree(&counter);
+        SkipList<int> skip(4, 0.5, &counter);
+        SegmentedDeque<int> deque(&counter);
+        for (int i = 0; i < 50; ++i) {
+            list.Append(i);
+            listSeq.Append(i);
+            arraySeq.Append(i);
+            tree.insert(i);
+            skip.insert(i);
+            deque.push_back(i);
+            deque.push_front(-i);
+        }
+        LinkedList<int> listCopy(list);
+        BinaryTree<int> treeCopy(tree);
+        assert(listCopy.GetResource() == &counter);
+        assert(list.Get(49) == 49);
+        assert(tree.contains(42));
+        assert(skip.contains(17));
+        assert(deque[0] == -49 && deque[99] == 49);
+        outFile << "\n  Allocations while alive: " << counter.allocations
+                << ", bytes in use: " << counter.bytesInUse;
+        assert(counter.allocations > 0);
+    }
+    outFile << "\n  After destruction: allocations = " << counter.allocations
+            << ", deallocations = " << counter.deallocations;
+    assert(counter.allocations == counter.deallocations);
+    assert(counter.bytesInUse == 0);
+    outFile << " ✓" << std::endl;
+
+    // Тест 2: Монотонная арена
+    outFile << "\nTest 2: Monotonic arena...";
+    MonotonicArena arena(256);
+    {
+        BinaryTree<int> tree(&arena);
+        MutableArraySequence<double> seq(&arena);
+        for (int i = 0; i < 200; ++i) {
+            tree.insert(i);
+            seq.Append(i * 0.5);
+        }
+        assert(tree.contains(199));
+        assert(seq.Get(10) == 5.0);
+        outFile << "\n  Arena bytes after build: " << arena.BytesAllocated();
+        assert(arena.BytesAllocated() > 0);
+    }
+    void* a = arena.Allocate(1, 1);
+    void* b = arena.Allocate(sizeof(double), alignof(double));
+    assert(reinterpret_cast<std::size_t>(b) % alignof(double) == 0);
+    assert(a != b);
+    arena.Release();
+    outFile << "\n  Arena bytes after Release: " << arena.BytesAllocated();
+
+    // Выравнивание сильнее max_align_t: ресурс по умолчанию и InlineResource, который его туда отправляет
+    InlineResource<64> small;
+    const std::size_t alignments[] = {64, 256, 4096};
+    for (std::size_t alignment : alignments) {
+        void* wide = DefaultResource()->Allocate(100, alignment);
+        void* forwarded = small.Allocate(32, alignment);
+        assert(reinterpret_cast<std::size_t>(wide) % alignment == 0);
+        assert(reinterpret_cast<std::size_t>(forwarded) % alignment == 0 && !small.InUse());
+        small.Deallocate(forwarded, 32, alignment);
+        DefaultResource()->Deallocate(wide, 100, alignment);
+    }
+    assert(arena.BytesAllocated() == 0);
+    outFile << " ✓" << std::endl;
+
+    // Тест 3: Пул узлов переиспользует освобождённые блоки
+    outFile << "\nTest 3: Node pool...";
+    CountingResource poolUpstream;
+    {
+        NodePool pool(24, 8, &poolUpstream);
+        void* first = pool.Allocate(24);
+        pool.Deallocate(first, 24);
+        void* second = pool.Allocate(16);
+        assert(first == second);
+        for (int i = 0; i < 20; ++i) {
+            pool.Allocate(24);
+        }
+        outFile << "\n  Slabs requested: " << poolUpstream.allocations;
+        assert(poolUpstream.allocations == 3);
+        void* big = pool.Allocate(1000);
+        assert(poolUpstream.allocations == 4);
+        pool.Deallocate(big, 1000);
+
+        LinkedList<int> list(&pool);
+        for (int i = 0; i < 10; ++i) {
+            list.Append(i);
+        }
+        assert(list.GetLast() == 9);
+    }
+    assert(poolUpstream.bytesInUse == 0);
+    outFile << " ✓" << std::endl;
+
+    // Тест 4: LinkedList переиспользует свои узлы
+    outFile << "\nTest 4: LinkedList node recycling...";
+    CountingResource listUpstream;
+    {
+        LinkedList<int> list(&listUpstream);
+        for (int i = 0; i < 1000; ++i) {
+            list.Append(i);
+        }
+        long afterBuild = listUpstream.allocations;
+        LinkedList<int> small(&listUpstream);
+        small.Append(-1);
+        for (int round = 0; round < 10; ++round) {
+            list = small;
+            for (int i = 0; i < 999; ++i) {
+                list.Prepend(i);
+            }
+        }
+        outFile << "\n  Upstream allocations: after build = " << afterBuild
+                << ", after churn = " << listUpstream.allocations;
+        assert(list.GetLength() == 1000);
+        assert(list.GetLast() == -1);
+        assert(listUpstream.allocations == afterBuild + 1);
+    }
+    assert(listUpstream.bytesInUse == 0);
+    outFile << " ✓" << std::endl;
+
+    // Тест 5: небольшие массивы не выходят за встроенный буфер
+    outFile << "\nTest 5: Inline small buffer...";
+    CountingResource inlineUpstream;
+    {
+        InlineResource<DynamicArray<double>::BytesFor(8)> storage(&inlineUpstream);
+        MutableArraySequence<double> small(&storage);
+        small.Reserve(8);
+        for (int i = 0; i < 8; ++i) {
+            small.Append(i * 0.5);
+        }
+        assert(storage.InUse() && inlineUpstream.allocations == 0);
+        small.Append(4.0);
+        assert(!storage.InUse() && inlineUpstream.allocations == 1);
+        assert(small.GetLength() == 9 && small.GetLast() == 4.0 && small.Get(7) == 3.5);
+
+        double coeffs[] = {1.0, 2.0, 3.0};
+        LinearForm<double> form(coeffs, 3);
+        LinearForm<double> copy(form);
+        LinearForm<double> assigned;
+        assigned = copy;
+        assigned = assigned;
+        double x[] = {1.0, 1.0};
+        MutableArraySequence<double> variables(x, 2);
+        assert(copy.Evaluate(variables) == 6.0 && assigned.Evaluate(variables) == 6.0);
+        LinearForm<double> sum = form + assigned;
+        assert(sum.GetLast() == 6.0 && form.GetLast() == 3.0);
+
+        // Присваивание выражения, которое читает саму форму, тоже остаётся во встроенном буфере
+        LinearForm<double> a(coeffs, 3, &inlineUpstream);
+        LinearForm<double> b(coeffs, 3, &inlineUpstream);
+        long before = inlineUpstream.allocations;
+        a = a + b;
+        a = a * 2.0 - b;
+        assert(inlineUpstream.allocations == before);
+        assert(a.GetLength() == 3 && a.Get(0) == 3.0 && a.Get(2) == 9.0);
+    }
+    assert(inlineUpstream.bytesInUse == 0);
+    outFile << " ✓" << std::endl;
+
+    outFile << "\n=== All MemoryResource tests passed successfully! ===" << std::endl;
+
+    outFile.close();
+    std::cout << "Тесты завершены. Результаты записаны в outputMemory.txt" << std::endl;
+}
@@ -0,0 +1,429 @@
+#ifndef UNROLLED_LINKEDLIST_H
+#define UNROLLED_LINKEDLIST_H
+
+#include <stdexcept>
+#include <sstream>
+#include <string>
+#include <new>
+#include <utility>
+#include <type_traits>
+#include <iterator>
+#include <cstddef>
+#include "19_MemoryResource.h"
+
+// Развёрнутый список: в каждом узле (блоке) лежит несколько элементов подряд,
+// блок занимает примерно одну кэш-линию. Обход и Get(index) пропускают
+// элементы целыми блоками. Интерфейс совпадает с LinkedList, поэтому его можно
+// подставить как хранилище в MutableListSequence / ImmutableListSequence.
+template <class T> class UnrolledLinkedList
+    {
+        public:
+            explicit UnrolledLinkedList(MemoryResource* resource = DefaultResource());
+            UnrolledLinkedList(T* items, int count, MemoryResource* resource = DefaultResource());
+            UnrolledLinkedList(const UnrolledLinkedList<T>& list);
+            UnrolledLinkedList(const UnrolledLinkedList<T>& list, MemoryResource* resource);
+
+            ~UnrolledLinkedList();
+
+            T GetFirst() const;
+            T GetLast() const;
+            T Get(int index) const;
+            UnrolledLinkedList<T>* GetSubList(int startIndex, int endIndex) const;
+            int GetLength() const;
+
+            void Append(T item);
+            void Prepend(T item);
+            void InsertAt(T item, int index);
+            template <class InputIt> void InsertRange(int index, InputIt first, InputIt last);
+            UnrolledLinkedList<T>* Concat(UnrolledLinkedList<T>* list) const;
+            UnrolledLinkedList& operator= (const UnrolledLinkedList<T>& list);
+            std::string ToString() const;
+            MemoryResource* GetResource() const;
+
+            static constexpr int BLOCK_CAPACITY =
+                (64 - 2 * static_cast<int>(sizeof(void*))) / static_cast<int>(sizeof(T)) > 4
+                    ? (64 - 2 * static_cast<int>(sizeof(void*))) / static_cast<int>(sizeof(T))
+                    : 4;
+
+        private:
+            struct Block
+                {
+                    Block* next;
+                    int count;
+                    typename std::aligned_storage<sizeof(T), alignof(T)>::type storage[BLOCK_CAPACITY];
+
+                    Block() : next(nullptr), count(0) {}
+
+                    T* Items() { return reinterpret_cast<T*>(storage); }
+                    const T* Items() const { return reinterpret_cast<const T*>(storage); }
+                };
+
+        public:
+            // Обход: внутри блока - по смежному массиву, между блоками - по next
+            class ConstIterator
+                {
+                    public:
+                        typedef std::forward_iterator_tag iterator_category;
+                        typedef T value_type;
+                        typedef std::ptrdiff_t difference_type;
+                        typedef const T* pointer;
+                        typedef const T& reference;
+
+                        explicit ConstIterator(const Block* block = nullptr) : block(block), offset(0) {}
+
+                        const T& operator*() const { return block->Items()[offset]; }
+                        const T* operator->() const { return block->Items() + offset; }
+                        ConstIterator& operator++() {
+                            if (++offset == block->count) {
+                                block = block->next;
+                                offset = 0;
+                            }
+                            return *this;
+                        }
+                        ConstIterator operator++(int) { ConstIterator old = *this; ++*this; return old; }
+                        bool operator==(const ConstIterator& other) const { return block == other.block && offset == other.offset; }
+                        bool operator!=(const ConstIterator& other) const { return !(*this == other); }
+
+                    private:
+                        const Block* block;
+                        int offset;
+                };
+
+            ConstIterator begin() const { return ConstIterator(head); }
+            ConstIterator end() const { return ConstIterator(); }
+
+        private:
+            Block* head;
+            Block* tail;
+            int size;
+            MemoryResource* resource;
+            NodePool pool;
+            // Как в LinkedList: блок последнего Get и индекс его первого элемента.
+            // Сбрасывается при вставке не в конец
+            mutable Block* fingerBlock;
+            mutable int fingerBase;
+
+            Block* NewBlock();
+            void DeleteBlock(Block* block);
+            void DeleteChain(Block* block);
+            void InsertIntoBlock(Block* block, int offset, T&& item);
+            void Clear();
+    };
+
+template <class T> constexpr int UnrolledLinkedList<T>::BLOCK_CAPACITY;
+
+////////////////////////////////////////////////////////////////////////////
+
+template <class T> UnrolledLinkedList<T>::UnrolledLinkedList(MemoryResource* resource)
+    : head(nullptr), tail(nullptr), size(0), resource(resource), pool(sizeof(Block), 4, resource, 256),
+      fingerBlock(nullptr), fingerBase(0) {}
+
+template <class T> UnrolledLinkedList<T>::UnrolledLinkedList(T* items, int count, MemoryResource* resource)
+    : UnrolledLinkedList(resource) {
+    for (int i = 0; i < count; ++i) {
+        Append(items[i]);
+    }
+}
+
+template <class T> UnrolledLinkedList<T>::UnrolledLinkedList(const UnrolledLinkedList<T>& list)
+    : UnrolledLinkedList(list, list.resource) {}
+
+template <class T> UnrolledLinkedList<T>::UnrolledLinkedList(const UnrolledLinkedList<T>& list, MemoryResource* resource)
+    : UnrolledLinkedList(resource) {
+    for (Block* block = list.head; block != nullptr; block = block->next) {
+        for (int i = 0; i < block->count; ++i) {
+            Append(block->Items()[i]);
+        }
+    }
+}
+
+template <class T> UnrolledLinkedList<T>::~UnrolledLinkedList() {
+    if (!std::is_trivially_destructible<T>::value) {
+        Clear();
+    }
+}
+
+template <class T> typename UnrolledLinkedList<T>::Block* UnrolledLinkedList<T>::NewBlock() {
+    return NewObject<Block>(&pool);
+}
+
+template <class T> void UnrolledLinkedList<T>::DeleteBlock(Block* block) {
+    for (int i = 0; i < block->count; ++i) {
+        block->Items()[i].~T();
+    }
+    DeleteObject(&pool, block);
+}
+
+template <class T> void UnrolledLinkedList<T>::DeleteChain(Block* block) {
+    while (block != nullptr) {
+        Block* temp = block;
+        block = block->next;
+        DeleteBlock(temp);
+    }
+}
+
+template <class T> void UnrolledLinkedList<T>::Clear() {
+    DeleteChain(head);
+    head = nullptr;
+    tail = nullptr;
+    size = 0;
+    fingerBlock = nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+template <class T> T UnrolledLinkedList<T>::GetFirst() const {
+    if (size == 0) {
+        throw std::out_of_range("List is empty");
+    }
+    return head->Items()[0];
+}
+
+template <class T> T UnrolledLinkedList<T>::GetLast() const {
+    if (size == 0) {
+        throw std::out_of_range("List is empty");
+    }
+    return tail->Items()[tail->count - 1];
+}
+
+template <class T> T UnrolledLinkedList<T>::Get(int index) const {
+    if (index < 0 || index >= size) {
+        throw std::out_of_range("Index out of range");
+    }
+
+    Block* current = head;
+    int base = 0;
+    if (fingerBlock != nullptr && fingerBase <= index) {
+        current = fingerBlock;
+        base = fingerBase;
+    }
+    while (index - base >= current->count) {
+        base += current->count;
+        current = current->next;
+    }
+    fingerBlock = current;
+    fingerBase = base;
+    return current->Items()[index - base];
+}
+
+template <class T> UnrolledLinkedList<T>* UnrolledLinkedList<T>::GetSubList(int startIndex, int endIndex) const {
+    if (startIndex < 0 || endIndex >= size || startIndex > endIndex) {
+        throw std::out_of_range("Invalid index range");
+    }
+
+    UnrolledLinkedList<T>* subList = new UnrolledLinkedList<T>(resource);
+    Block* current = head;
+    int offset = startIndex;
+    while (offset >= current->count) {
+        offset -= current->count;
+        current = current->next;
+    }
+    for (int remaining = endIndex - startIndex + 1; remaining > 0; --remaining) {
+        subList->Append(current->Items()[offset]);
+        if (++offset == current->count) {
+            current = current->next;
+            offset = 0;
+        }
+    }
+    return subList;
+}
+
+template <class T> int UnrolledLinkedList<T>::GetLength() const {
+    return size;
+}
+
+template <class T> MemoryResource* UnrolledLinkedList<T>::GetResource() const {
+    return resource;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+// Вставка в блок со сдвигом хвоста блока. Полный блок делится пополам.
+template <class T> void UnrolledLinkedList<T>::InsertIntoBlock(Block* block, int offset, T&& item) {
+    fingerBlock = nullptr;
+    if (block->count == BLOCK_CAPACITY) {
+        Block* right = NewBlock();
+        int half = BLOCK_CAPACITY / 2;
+        for (int i = half; i < BLOCK_CAPACITY; ++i) {
+            new (right->Items() + (i - half)) T(std::move(block->Items()[i]));
+            block->Items()[i].~T();
+        }
+        right->count = BLOCK_CAPACITY - half;
+        block->count = half;
+        right->next = block->next;
+        block->next = right;
+        if (tail == block) {
+            tail = right;
+        }
+        if (offset > half) {
+            block = right;
+            offset -= half;
+        }
+    }
+
+    T* items = block->Items();
+    if (offset == block->count) {
+        new (items + offset) T(std::move(item));
+    } else {
+        new (items + block->count) T(std::move(items[block->count - 1]));
+        for (int i = block->count - 1; i > offset; --i) {
+            items[i] = std::move(items[i - 1]);
+        }
+        items[offset] = std::move(item);
+    }
+    block->count++;
+    size++;
+}
+
+template <class T> void UnrolledLinkedList<T>::Append(T item) {
+    if (tail == nullptr) {
+        head = tail = NewBlock();
+    }
+    else if (tail->count == BLOCK_CAPACITY) {
+        Block* block = NewBlock();
+        tail->next = block;
+        tail = block;
+    }
+    new (tail->Items() + tail->count) T(std::move(item));
+    tail->count++;
+    size++;
+}
+
+template <class T> void UnrolledLinkedList<T>::Prepend(T item) {
+    if (head == nullptr || head->count == BLOCK_CAPACITY) {
+        Block* block = NewBlock();
+        block->next = head;
+        head = block;
+        if (tail == nullptr) {
+            tail = block;
+        }
+    }
+    InsertIntoBlock(head, 0, std::move(item));
+}
+
+template <class T> void UnrolledLinkedList<T>::InsertAt(T item, int index) {
+    if (index < 0 || index > size) {
+        throw std::out_of_range("Index out of range");
+    }
+
+    if (index == size) {
+        Append(std::move(item));
+        return;
+    }
+
+    Block* current = head;
+    while (index > current->count) {
+        index -= current->count;
+        current = current->next;
+    }
+    InsertIntoBlock(current, index, std::move(item));
+}
+
+// Элементы диапазона раскладываются по новым полным блокам, затем блок с позицией index
+// делится в этой точке, и новые блоки встают между его половинами.
+// Блок ищется один раз, сдвигаются только элементы одного блока
+template <class T> template <class InputIt> void UnrolledLinkedList<T>::InsertRange(int index, InputIt first, InputIt last) {
+    if (index < 0 || index > size) {
+        throw std::out_of_range("Index out of range");
+    }
+
+    Block* chainHead = nullptr;
+    Block* chainTail = nullptr;
+    int count = 0;
+    try {
+        for (; first != last; ++first, ++count) {
+            if (chainTail == nullptr || chainTail->count == BLOCK_CAPACITY) {
+                Block* block = NewBlock();
+                if (chainHead == nullptr) chainHead = block;
+                else chainTail->next = block;
+                chainTail = block;
+            }
+            new (chainTail->Items() + chainTail->count) T(*first);
+            chainTail->count++;
+        }
+    } catch (...) {
+        DeleteChain(chainHead);
+        throw;
+    }
+    if (count == 0) {
+        return;
+    }
+
+    fingerBlock = nullptr;
+    if (index == 0) {
+        chainTail->next = head;
+        head = chainHead;
+        if (tail == nullptr) tail = chainTail;
+        size += count;
+        return;
+    }
+
+    Block* current = head;
+    while (index > current->count) {
+        index -= current->count;
+        current = current->next;
+    }
+    if (index < current->count) {
+        Block* right;
+        try {
+            right = NewBlock();
+        } catch (...) {
+            DeleteChain(chainHead);
+            throw;
+        }
+        for (int i = index; i < current->count; ++i) {
+            new (right->Items() + (i - index)) T(std::move(current->Items()[i]));
+            current->Items()[i].~T();
+        }
+        right->count = current->count - index;
+        current->count = index;
+        right->next = current->next;
+        current->next = right;
+        if (tail == current) tail = right;
+    }
+    chainTail->next = current->next;
+    current->next = chainHead;
+    if (tail == current) tail = chainTail;
+    size += count;
+}
+
+template <class T> UnrolledLinkedList<T>* UnrolledLinkedList<T>::Concat(UnrolledLinkedList<T>* list) const {
+    if (list == nullptr) {
+        throw std::invalid_argument("List cannot be null");
+    }
+
+    UnrolledLinkedList<T>* newList = new UnrolledLinkedList<T>(*this);
+    for (Block* block = list->head; block != nullptr; block = block->next) {
+        for (int i = 0; i < block->count; ++i) {
+            newList->Append(block->Items()[i]);
+        }
+    }
+    return newList;
+}
+
+template <class T> UnrolledLinkedList<T>& UnrolledLinkedList<T>::operator=(const UnrolledLinkedList<T>& list) {
+    if (this != &list) {
+        Clear();
+        for (Block* block = list.head; block != nullptr; block = block->next) {
+            for (int i = 0; i < block->count; ++i) {
+                Append(block->Items()[i]);
+            }
+        }
+    }
+    return *this;
+}
+
+template <class T> std::string UnrolledLinkedList<T>::ToString() const {
+    std::ostringstream oss;
+    oss << "[";
+    for (Block* block = head; block != nullptr; block = block->next) {
+        for (int i = 0; i < block->count; ++i) {
+            oss << block->Items()[i];
+            if (block->next != nullptr || i < block->count - 1) oss << ", ";
+        }
+    }
+    oss << "]";
+    return oss.str();
+}
+
+#endif
@@ -0,0 +1,105 @@
+#include "2_ListSequence.h"
+#include <iostream>
+#include <fstream>
+#include <cassert>
+#include <cstdlib>
+#include <string>
+
+void testUnrolledList() {
+    std::ofstream outFile("outputUnrolled.txt");
+    if (!outFile) {
+        std::cerr << "Не удалось открыть файл outputUnrolled.txt для записи" << std::endl;
+        return;
+    }
+
+    outFile << "=== Starting UnrolledLinkedList tests ===" << std::endl;
+    outFile << "Block capacity for int: " << UnrolledLinkedList<int>::BLOCK_CAPACITY << std::endl;
+
+    // Тест 1: Совпадение с LinkedList на случайных вставках
+    outFile << "\nTest 1: Random inserts match LinkedList...";
+    std::srand(12345);
+    LinkedList<int> reference;
+    UnrolledLinkedList<int> unrolled;
+    for (int i = 0; i < 2000; ++i) {
+        int action = std::rand() % 3;
+        if (action == 0) {
+            reference.Append(i);
+            unrolled.Append(i);
+        } else if (action == 1) {
+            reference.Prepend(i);
+            unrolled.Prepend(i);
+        } else {
+            int index = std::rand() % (reference.GetLength() + 1);
+            reference.InsertAt(i, index);
+            unrolled.InsertAt(i, index);
+        }
+    }
+    assert(unrolled.GetLength() == reference.GetLength());
+    for (int i = 0; i < reference.GetLength(); ++i) {
+        assert(unrolled.Get(i) == reference.Get(i));
+    }
+    assert(unrolled.GetFirst() == reference.GetFirst());
+    assert(unrolled.GetLast() == reference.GetLast());
+    assert(unrolled.ToString() == reference.ToString());
+    outFile << " length = " << unrolled.GetLength() << " ✓" << std::endl;
+
+    // Тест 2: Подсписок, копия, присваивание, конкатенация
+    outFile << "\nTest 2: Sublist, copy, assignment, concat...";
+    UnrolledLinkedList<int>* sub = unrolled.GetSubList(17, 1017);
+    LinkedList<int>* referenceSub = reference.GetSubList(17, 1017);
+    assert(sub->ToString() == referenceSub->ToString());
+    UnrolledLinkedList<int> copy(*sub);
+    UnrolledLinkedList<int>* joined = copy.Concat(sub);
+    assert(joined->GetLength() == 2002);
+    assert(joined->Get(1001) == sub->GetFirst());
+    copy = unrolled;
+    assert(copy.ToString() == unrolled.ToString());
+    delete sub;
+    delete referenceSub;
+    delete joined;
+    outFile << " ✓" << std::endl;
+
+    // Тест 3: Как хранилище ListSequence, нетривиальный тип
+    outFile << "\nTest 3: ListSequence over UnrolledLinkedList...";
+    MutableListSequence<std::string, UnrolledLinkedList<std::string>> words;
+    for (int i = 0; i < 50; ++i) {
+        words.Append("w" + std::to_string(i));
+    }
+    words.Prepend("first");
+    words.InsertAt("middle", 25);
+    ListSequence<std::string, UnrolledLinkedList<std::string>>* part = words.GetSubsequence(24, 26);
+    outFile << "\n  Subsequence: " << part->ToString();
+    assert(part->Get(1) == "middle");
+    delete part;
+
+    ImmutableListSequence<int, UnrolledLinkedList<int>> frozen;
+    Sequence<int>* next = frozen.Append(1);
+    assert(frozen.GetLength() == 0);
+    assert(next->GetLength() == 1);
+    delete next;
+    outFile << " ✓" << std::endl;
+
+    // Тест 4: Исключения
+    outFile << "\nTest 4: Exceptions...";
+    bool thrown = false;
+    try {
+        unrolled.Get(unrolled.GetLength());
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    thrown = false;
+    try {
+        UnrolledLinkedList<int> empty;
+        empty.GetLast();
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    outFile << " ✓" << std::endl;
+
+    outFile << "\n=== All UnrolledLinkedList tests passed successfully! ===" << std::endl;
+
+    outFile.close();
+    std::cout << "Тесты завершены. Результаты записаны в outputUnrolled.txt" << std::endl;
+}
@@ -0,0 +1,435 @@
+#ifndef DOUBLY_LINKEDLIST_H
+#define DOUBLY_LINKEDLIST_H
+
+#include <stdexcept>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <type_traits>
+#include <iterator>
+#include <cstddef>
+#include "19_MemoryResource.h"
+
+// Двусвязный список: удаление с обоих концов за O(1) и курсор,
+// через который вставка и удаление в текущей позиции тоже O(1).
+// Интерфейс LinkedList сохранён, поэтому список подходит как хранилище ListSequence.
+template <class T> class DoublyLinkedList
+    {
+        private:
+            struct Node
+                {
+                    T data;
+                    Node* prev;
+                    Node* next;
+                    Node(T data) : data(std::move(data)), prev(nullptr), next(nullptr) {}
+                };
+
+        public:
+            // Курсор указывает на узел списка (или за его конец). Остаётся валидным,
+            // пока не удалён его собственный узел; вставки и удаления других узлов его не портят.
+            class Cursor
+                {
+                    public:
+                        bool IsValid() const { return node != nullptr; }
+                        T Get() const;
+                        void Set(T value);
+
+                        Cursor& Next();
+                        Cursor& Prev();
+
+                        void InsertBefore(T item);
+                        void InsertAfter(T item);
+                        T Erase();
+
+                    private:
+                        friend class DoublyLinkedList<T>;
+                        DoublyLinkedList<T>* list;
+                        Node* node;
+
+                        Cursor(DoublyLinkedList<T>* list, Node* node) : list(list), node(node) {}
+                        void CheckValid() const;
+                };
+
+            // Двунаправленный итератор только для чтения; менять список - через Cursor
+            class ConstIterator
+                {
+                    public:
+                        typedef std::bidirectional_iterator_tag iterator_category;
+                        typedef T value_type;
+                        typedef std::ptrdiff_t difference_type;
+                        typedef const T* pointer;
+                        typedef const T& reference;
+
+                        const T& operator*() const { return node->data; }
+                        const T* operator->() const { return &node->data; }
+                        ConstIterator& operator++() { node = node->next; return *this; }
+                        ConstIterator operator++(int) { ConstIterator old = *this; node = node->next; return old; }
+                        // у end() узла нет, шаг назад от него ведёт к хвосту списка
+                        ConstIterator& operator--() { node = node == nullptr ? list->tail : node->prev; return *this; }
+                        ConstIterator operator--(int) { ConstIterator old = *this; --*this; return old; }
+                        bool operator==(const ConstIterator& other) const { return node == other.node; }
+                        bool operator!=(const ConstIterator& other) const { return node != other.node; }
+
+                    private:
+                        friend class DoublyLinkedList<T>;
+                        const DoublyLinkedList<T>* list;
+                        const Node* node;
+
+                        ConstIterator(const DoublyLinkedList<T>* list, const Node* node) : list(list), node(node) {}
+                };
+
+            explicit DoublyLinkedList(MemoryResource* resource = DefaultResource());
+            DoublyLinkedList(T* items, int count, MemoryResource* resource = DefaultResource());
+            DoublyLinkedList(const DoublyLinkedList<T>& list);
+            DoublyLinkedList(const DoublyLinkedList<T>& list, MemoryResource* resource);
+
+            ~DoublyLinkedList();
+
+            T GetFirst() const;
+            T GetLast() const;
+            T Get(int index) const;
+            DoublyLinkedList<T>* GetSubList(int startIndex, int endIndex) const;
+            int GetLength() const;
+
+            void Append(T item);
+            void Prepend(T item);
+            void InsertAt(T item, int index);
+            template <class InputIt> void InsertRange(int index, InputIt first, InputIt last);
+            T RemoveFirst();
+            T RemoveLast();
+            T RemoveAt(int index);
+            DoublyLinkedList<T>* Concat(DoublyLinkedList<T>* list) const;
+            DoublyLinkedList& operator= (const DoublyLinkedList<T>& list);
+            std::string ToString() const;
+            MemoryResource* GetResource() const;
+
+            Cursor CursorFirst();
+            Cursor CursorLast();
+            Cursor CursorAt(int index);
+
+            ConstIterator begin() const { return ConstIterator(this, head); }
+            ConstIterator end() const { return ConstIterator(this, nullptr); }
+
+        private:
+            Node* head;
+            Node* tail;
+            int size;
+            MemoryResource* resource;
+            NodePool pool;
+
+            Node* NodeAt(int index) const;
+            Node* InsertBefore(Node* position, T&& item);
+            T Unlink(Node* node);
+            void Clear();
+    };
+
+////////////////////////////////////////////////////////////////////////////
+
+template <class T> DoublyLinkedList<T>::DoublyLinkedList(MemoryResource* resource)
+    : head(nullptr), tail(nullptr), size(0), resource(resource), pool(sizeof(Node), 8, resource, 512) {}
+
+template <class T> DoublyLinkedList<T>::DoublyLinkedList(T* items, int count, MemoryResource* resource)
+    : DoublyLinkedList(resource) {
+    for (int i = 0; i < count; ++i) {
+        Append(items[i]);
+    }
+}
+
+template <class T> DoublyLinkedList<T>::DoublyLinkedList(const DoublyLinkedList<T>& list)
+    : DoublyLinkedList(list, list.resource) {}
+
+template <class T> DoublyLinkedList<T>::DoublyLinkedList(const DoublyLinkedList<T>& list, MemoryResource* resource)
+    : DoublyLinkedList(resource) {
+    for (Node* current = list.head; current != nullptr; current = current->next) {
+        Append(current->data);
+    }
+}
+
+template <class T> DoublyLinkedList<T>::~DoublyLinkedList() {
+    if (!std::is_trivially_destructible<T>::value) {
+        Clear();
+    }
+}
+
+template <class T> void DoublyLinkedList<T>::Clear() {
+    while (head != nullptr) {
+        Node* temp = head;
+        head = head->next;
+        DeleteObject(&pool, temp);
+    }
+    tail = nullptr;
+    size = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+template <class T> T DoublyLinkedList<T>::GetFirst() const {
+    if (size == 0) {
+        throw std::out_of_range("List is empty");
+    }
+    return head->data;
+}
+
+template <class T> T DoublyLinkedList<T>::GetLast() const {
+    if (size == 0) {
+        throw std::out_of_range("List is empty");
+    }
+    return tail->data;
+}
+
+// Идём от ближайшего конца
+template <class T> typename DoublyLinkedList<T>::Node* DoublyLinkedList<T>::NodeAt(int index) const {
+    if (index < 0 || index >= size) {
+        throw std::out_of_range("Index out of range");
+    }
+
+    Node* current;
+    if (index < size / 2) {
+        current = head;
+        for (int i = 0; i < index; ++i) {
+            current = current->next;
+        }
+    } else {
+        current = tail;
+        for (int i = size - 1; i > index; --i) {
+            current = current->prev;
+        }
+    }
+    return current;
+}
+
+template <class T> T DoublyLinkedList<T>::Get(int index) const {
+    return NodeAt(index)->data;
+}
+
+template <class T> DoublyLinkedList<T>* DoublyLinkedList<T>::GetSubList(int startIndex, int endIndex) const {
+    if (startIndex < 0 || endIndex >= size || startIndex > endIndex) {
+        throw std::out_of_range("Invalid index range");
+    }
+
+    DoublyLinkedList<T>* subList = new DoublyLinkedList<T>(resource);
+    Node* current = NodeAt(startIndex);
+    for (int i = startIndex; i <= endIndex; ++i) {
+        subList->Append(current->data);
+        current = current->next;
+    }
+    return subList;
+}
+
+template <class T> int DoublyLinkedList<T>::GetLength() const {
+    return size;
+}
+
+template <class T> MemoryResource* DoublyLinkedList<T>::GetResource() const {
+    return resource;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+// Вставка перед position; position == nullptr - вставка в конец
+template <class T> typename DoublyLinkedList<T>::Node* DoublyLinkedList<T>::InsertBefore(Node* position, T&& item) {
+    Node* newNode = NewObject<Node>(&pool, std::move(item));
+    newNode->next = position;
+    newNode->prev = (position != nullptr) ? position->prev : tail;
+
+    if (newNode->prev != nullptr) {
+        newNode->prev->next = newNode;
+    } else {
+        head = newNode;
+    }
+    if (position != nullptr) {
+        position->prev = newNode;
+    } else {
+        tail = newNode;
+    }
+    size++;
+    return newNode;
+}
+
+template <class T> T DoublyLinkedList<T>::Unlink(Node* node) {
+    if (node->prev != nullptr) {
+        node->prev->next = node->next;
+    } else {
+        head = node->next;
+    }
+    if (node->next != nullptr) {
+        node->next->prev = node->prev;
+    } else {
+        tail = node->prev;
+    }
+    size--;
+
+    T value = std::move(node->data);
+    DeleteObject(&pool, node);
+    return value;
+}
+
+template <class T> void DoublyLinkedList<T>::Append(T item) {
+    InsertBefore(nullptr, std::move(item));
+}
+
+template <class T> void DoublyLinkedList<T>::Prepend(T item) {
+    InsertBefore(head, std::move(item));
+}
+
+template <class T> void DoublyLinkedList<T>::InsertAt(T item, int index) {
+    if (index < 0 || index > size) {
+        throw std::out_of_range("Index out of range");
+    }
+    InsertBefore(index == size ? nullptr : NodeAt(index), std::move(item));
+}
+
+// Как в LinkedList: цепочка из элементов диапазона собирается отдельно
+// и вставляется перед узлом index целиком, узел ищется один раз
+template <class T> template <class InputIt> void DoublyLinkedList<T>::InsertRange(int index, InputIt first, InputIt last) {
+    if (index < 0 || index > size) {
+        throw std::out_of_range("Index out of range");
+    }
+
+    Node* chainHead = nullptr;
+    Node* chainTail = nullptr;
+    int count = 0;
+    try {
+        for (; first != last; ++first, ++count) {
+            Node* newNode = NewObject<Node>(&pool, *first);
+            newNode->prev = chainTail;
+            if (chainHead == nullptr) chainHead = newNode;
+            else chainTail->next = newNode;
+            chainTail = newNode;
+        }
+    } catch (...) {
+        while (chainHead != nullptr) {
+            Node* temp = chainHead;
+            chainHead = chainHead->next;
+            DeleteObject(&pool, temp);
+        }
+        throw;
+    }
+    if (count == 0) {
+        return;
+    }
+
+    Node* position = index == size ? nullptr : NodeAt(index);
+    Node* before = position != nullptr ? position->prev : tail;
+    chainHead->prev = before;
+    chainTail->next = position;
+    if (before != nullptr) before->next = chainHead;
+    else head = chainHead;
+    if (position != nullptr) position->prev = chainTail;
+    else tail = chainTail;
+    size += count;
+}
+
+template <class T> T DoublyLinkedList<T>::RemoveFirst() {
+    if (size == 0) {
+        throw std::out_of_range("List is empty");
+    }
+    return Unlink(head);
+}
+
+template <class T> T DoublyLinkedList<T>::RemoveLast() {
+    if (size == 0) {
+        throw std::out_of_range("List is empty");
+    }
+    return Unlink(tail);
+}
+
+template <class T> T DoublyLinkedList<T>::RemoveAt(int index) {
+    return Unlink(NodeAt(index));
+}
+
+template <class T> DoublyLinkedList<T>* DoublyLinkedList<T>::Concat(DoublyLinkedList<T>* list) const {
+    if (list == nullptr) {
+        throw std::invalid_argument("List cannot be null");
+    }
+
+    DoublyLinkedList<T>* newList = new DoublyLinkedList<T>(*this);
+    for (Node* current = list->head; current != nullptr; current = current->next) {
+        newList->Append(current->data);
+    }
+    return newList;
+}
+
+template <class T> DoublyLinkedList<T>& DoublyLinkedList<T>::operator=(const DoublyLinkedList<T>& list) {
+    if (this != &list) {
+        Clear();
+        for (Node* current = list.head; current != nullptr; current = current->next) {
+            Append(current->data);
+        }
+    }
+    return *this;
+}
+
+template <class T> std::string DoublyLinkedList<T>::ToString() const {
+    std::ostringstream oss;
+    oss << "[";
+    for (Node* current = head; current != nullptr; current = current->next) {
+        oss << current->data;
+        if (current->next != nullptr) oss << ", ";
+    }
+    oss << "]";
+    return oss.str();
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+template <class T> typename DoublyLinkedList<T>::Cursor DoublyLinkedList<T>::CursorFirst() {
+    return Cursor(this, head);
+}
+
+template <class T> typename DoublyLinkedList<T>::Cursor DoublyLinkedList<T>::CursorLast() {
+    return Cursor(this, tail);
+}
+
+template <class T> typename DoublyLinkedList<T>::Cursor DoublyLinkedList<T>::CursorAt(int index) {
+    return Cursor(this, NodeAt(index));
+}
+
+template <class T> void DoublyLinkedList<T>::Cursor::CheckValid() const {
+    if (node == nullptr) {
+        throw std::out_of_range("Cursor is out of list");
+    }
+}
+
+template <class T> T DoublyLinkedList<T>::Cursor::Get() const {
+    CheckValid();
+    return node->data;
+}
+
+template <class T> void DoublyLinkedList<T>::Cursor::Set(T value) {
+    CheckValid();
+    node->data = std::move(value);
+}
+
+template <class T> typename DoublyLinkedList<T>::Cursor& DoublyLinkedList<T>::Cursor::Next() {
+    CheckValid();
+    node = node->next;
+    return *this;
+}
+
+template <class T> typename DoublyLinkedList<T>::Cursor& DoublyLinkedList<T>::Cursor::Prev() {
+    CheckValid();
+    node = node->prev;
+    return *this;
+}
+
+// На невалидном курсоре (за концом списка) вставляет в конец
+template <class T> void DoublyLinkedList<T>::Cursor::InsertBefore(T item) {
+    list->InsertBefore(node, std::move(item));
+}
+
+template <class T> void DoublyLinkedList<T>::Cursor::InsertAfter(T item) {
+    CheckValid();
+    list->InsertBefore(node->next, std::move(item));
+}
+
+// Удаляет текущий элемент и переходит к следующему
+template <class T> T DoublyLinkedList<T>::Cursor::Erase() {
+    CheckValid();
+    Node* next = node->next;
+    T value = list->Unlink(node);
+    node = next;
+    return value;
+}
+
+#endif
@@ -0,0 +1,123 @@
+#include "2_ListSequence.h"
+#include <iostream>
+#include <fstream>
+#include <cassert>
+#include <cstdlib>
+#include <vector>
+
+void testDoublyLinkedList() {
+    std::ofstream outFile("outputDoubly.txt");
+    if (!outFile) {
+        std::cerr << "Не удалось открыть файл outputDoubly.txt для записи" << std::endl;
+        return;
+    }
+
+    outFile << "=== Starting DoublyLinkedList tests ===" << std::endl;
+
+    // Тест 1: Удаление с концов и по индексу
+    outFile << "\nTest 1: RemoveFirst / RemoveLast / RemoveAt...";
+    int items[] = {1, 2, 3, 4, 5, 6};
+    DoublyLinkedList<int> list(items, 6);
+    assert(list.RemoveFirst() == 1);
+    assert(list.RemoveLast() == 6);
+    assert(list.RemoveAt(1) == 3);
+    outFile << "\n  List: " << list.ToString();
+    assert(list.ToString() == "[2, 4, 5]");
+    assert(list.GetFirst() == 2 && list.GetLast() == 5);
+    list.RemoveFirst();
+    list.RemoveFirst();
+    list.RemoveFirst();
+    assert(list.GetLength() == 0);
+    bool thrown = false;
+    try {
+        list.RemoveLast();
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    outFile << " ✓" << std::endl;
+
+    // Тест 2: Курсор
+    outFile << "\nTest 2: Cursor insert and erase...";
+    DoublyLinkedList<int> numbers(items, 6);
+    DoublyLinkedList<int>::Cursor cursor = numbers.CursorFirst();
+    while (cursor.IsValid()) {
+        if (cursor.Get() % 2 == 0) {
+            cursor.Erase();
+        } else {
+            cursor.InsertAfter(cursor.Get() * 10);
+            cursor.Next().Next();
+        }
+    }
+    outFile << "\n  After erase evens / insert x10: " << numbers.ToString();
+    assert(numbers.ToString() == "[1, 10, 3, 30, 5, 50]");
+    DoublyLinkedList<int>::Cursor back = numbers.CursorLast();
+    back.Prev();
+    back.InsertBefore(4);
+    back.Set(6);
+    assert(numbers.ToString() == "[1, 10, 3, 30, 4, 6, 50]");
+    outFile << " ✓" << std::endl;
+
+    // Тест 3: Случайные операции против std::vector
+    outFile << "\nTest 3: Random operations...";
+    std::srand(777);
+    DoublyLinkedList<int> randomList;
+    std::vector<int> reference;
+    for (int i = 0; i < 3000; ++i) {
+        int action = std::rand() % 7;
+        if (action <= 1 || reference.empty()) {
+            int index = std::rand() % (static_cast<int>(reference.size()) + 1);
+            randomList.InsertAt(i, index);
+            reference.insert(reference.begin() + index, i);
+        } else if (action <= 3) {
+            randomList.Append(i);
+            reference.push_back(i);
+        } else if (action == 4) {
+            assert(randomList.RemoveFirst() == reference.front());
+            reference.erase(reference.begin());
+        } else if (action == 5) {
+            assert(randomList.RemoveLast() == reference.back());
+            reference.pop_back();
+        } else {
+            int index = std::rand() % static_cast<int>(reference.size());
+            assert(randomList.RemoveAt(index) == reference[index]);
+            reference.erase(reference.begin() + index);
+        }
+    }
+    assert(randomList.GetLength() == static_cast<int>(reference.size()));
+    for (int i = 0; i < randomList.GetLength(); ++i) {
+        assert(randomList.Get(i) == reference[i]);
+    }
+    outFile << " length = " << randomList.GetLength() << " ✓" << std::endl;
+
+    // Тест 4: Скользящее окно через ListSequence
+    outFile << "\nTest 4: Sliding window over ListSequence...";
+    MutableListSequence<int, DoublyLinkedList<int>> window;
+    int windowSum = 0;
+    for (int i = 1; i <= 100; ++i) {
+        window.Append(i);
+        windowSum += i;
+        if (window.GetLength() > 5) {
+            windowSum -= window.GetFirst();
+            window.RemoveFirst();
+        }
+    }
+    outFile << "\n  Window: " << window.ToString() << ", sum = " << windowSum;
+    assert(window.GetLength() == 5);
+    assert(windowSum == 96 + 97 + 98 + 99 + 100);
+    auto windowCursor = window.CursorAt(2);
+    windowCursor.Erase();
+    assert(window.ToString() == "[96, 97, 99, 100]");
+
+    ImmutableListSequence<int, DoublyLinkedList<int>> frozen(items, 6);
+    ListSequence<int, DoublyLinkedList<int>>* shorter = frozen.RemoveLast();
+    assert(frozen.GetLength() == 6);
+    assert(shorter->GetLength() == 5);
+    delete shorter;
+    outFile << " ✓" << std::endl;
+
+    outFile << "\n=== All DoublyLinkedList tests passed successfully! ===" << std::endl;
+
+    outFile.close();
+    std::cout << "Тесты завершены. Результаты записаны в outputDoubly.txt" << std::endl;
+}
@@ -0,0 +1,81 @@
+#include "4_LinkedList.h"
+#include <iostream>
+#include <fstream>
+#include <cassert>
+#include <cstdlib>
+#include <vector>
+
+void testLinkedList() {
+    std::ofstream outFile("outputLinked.txt");
+    if (!outFile) {
+        std::cerr << "Не удалось открыть файл outputLinked.txt для записи" << std::endl;
+        return;
+    }
+
+    outFile << "=== Starting LinkedList tests ===" << std::endl;
+
+    // Тест 1: Последовательный доступ по индексу
+    outFile << "\nTest 1: Sequential Get...";
+    LinkedList<int> list;
+    for (int i = 0; i < 1000; ++i) {
+        list.Append(i);
+    }
+    long sum = 0;
+    for (int i = 0; i < list.GetLength(); ++i) {
+        sum += list.Get(i);
+    }
+    for (int i = list.GetLength() - 1; i >= 0; i -= 7) {
+        assert(list.Get(i) == i);
+    }
+    outFile << " sum = " << sum;
+    assert(sum == 999 * 1000 / 2);
+    outFile << " ✓" << std::endl;
+
+    // Тест 2: Вставки между обращениями не сбивают кэш позиции
+    outFile << "\nTest 2: Mixed Get / InsertAt / Prepend...";
+    std::srand(4242);
+    LinkedList<int> mixed;
+    std::vector<int> reference;
+    for (int i = 0; i < 3000; ++i) {
+        int action = std::rand() % 4;
+        if (action == 0) {
+            mixed.Prepend(i);
+            reference.insert(reference.begin(), i);
+        } else if (action == 1 || reference.empty()) {
+            mixed.Append(i);
+            reference.push_back(i);
+        } else if (action == 2) {
+            int index = std::rand() % (static_cast<int>(reference.size()) + 1);
+            mixed.InsertAt(i, index);
+            reference.insert(reference.begin() + index, i);
+        } else {
+            int index = std::rand() % static_cast<int>(reference.size());
+            assert(mixed.Get(index) == reference[index]);
+        }
+    }
+    for (int i = 0; i < mixed.GetLength(); ++i) {
+        assert(mixed.Get(i) == reference[i]);
+    }
+    LinkedList<int>* sub = mixed.GetSubList(100, 200);
+    for (int i = 0; i < sub->GetLength(); ++i) {
+        assert(sub->Get(i) == reference[100 + i]);
+    }
+    delete sub;
+    outFile << " length = " << mixed.GetLength() << " ✓" << std::endl;
+
+    // Тест 3: Присваивание сбрасывает кэш
+    outFile << "\nTest 3: Assignment resets position cache...";
+    mixed.Get(500);
+    int small[] = {7, 8, 9};
+    LinkedList<int> other(small, 3);
+    mixed = other;
+    assert(mixed.Get(0) == 7);
+    assert(mixed.Get(1) == 8);
+    assert(mixed.Get(2) == 9);
+    outFile << " ✓" << std::endl;
+
+    outFile << "\n=== All LinkedList tests passed successfully! ===" << std::endl;
+
+    outFile.close();
+    std::cout << "Тесты завершены. Результаты записаны в outputLinked.txt" << std::endl;
+}
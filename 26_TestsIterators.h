@@ -0,0 +1,131 @@
+#include "2_ListSequence.h"
+#include "1_ArraySequence.h"
+#include "5_LinearForm.h"
+#include <iostream>
+#include <fstream>
+#include <cassert>
+#include <numeric>
+#include <string>
+#include <vector>
+
+template <class List> void checkListSequenceIteration(std::ofstream& outFile, const char* name) {
+    int items[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20};
+    MutableListSequence<int, List> sequence(items, 20);
+    std::vector<int> collected(sequence.begin(), sequence.end());
+    assert(collected.size() == 20);
+    for (int i = 0; i < 20; ++i) {
+        assert(collected[i] == items[i]);
+    }
+    outFile << "\n  " << name << ": sum = " << std::accumulate(sequence.begin(), sequence.end(), 0);
+
+    MutableListSequence<int, List> empty;
+    assert(empty.begin() == empty.end());
+}
+
+void testIterators() {
+    std::ofstream outFile("outputIterators.txt");
+    if (!outFile) {
+        std::cerr << "Не удалось открыть файл outputIterators.txt для записи" << std::endl;
+        return;
+    }
+
+    outFile << "=== Starting Iterator tests ===" << std::endl;
+
+    // Тест 1: DynamicArray и ArraySequence - смежные итераторы
+    outFile << "\nTest 1: Contiguous iterators...";
+    DynamicArray<int> array(5);
+    int value = 0;
+    for (int& item : array) {
+        item = ++value;
+    }
+    assert(array.Get(0) == 1 && array.Get(4) == 5);
+    assert(array.end() - array.begin() == 5);
+    assert(array.Data() == array.begin());
+
+    int items[] = {3, 1, 4, 1, 5};
+    MutableArraySequence<int> sequence(items, 5);
+    const int* data = sequence.begin();
+    for (int i = 0; i < 5; ++i) {
+        assert(data[i] == items[i]);
+    }
+    assert(std::accumulate(sequence.begin(), sequence.end(), 0) == 14);
+    outFile << " ✓" << std::endl;
+
+    // Тест 2: LinkedList - изменение через итератор
+    outFile << "\nTest 2: LinkedList iterators...";
+    LinkedList<std::string> words;
+    words.Append("a");
+    words.Append("b");
+    words.Append("c");
+    for (std::string& word : words) {
+        word += word;
+    }
+    const LinkedList<std::string>& constWords = words;
+    std::string joined;
+    for (LinkedList<std::string>::ConstIterator it = constWords.begin(); it != constWords.end(); ++it) {
+        joined += *it;
+        joined += it->size() == 2 ? "|" : "?";
+    }
+    assert(joined == "aa|bb|cc|");
+    LinkedList<std::string>::ConstIterator first = words.begin();
+    assert(first == words.begin());
+    outFile << " " << words.ToString() << " ✓" << std::endl;
+
+    // Тест 3: ListSequence на всех хранилищах
+    outFile << "\nTest 3: ListSequence iterators...";
+    checkListSequenceIteration<LinkedList<int>>(outFile, "LinkedList");
+    checkListSequenceIteration<UnrolledLinkedList<int>>(outFile, "UnrolledLinkedList");
+    checkListSequenceIteration<DoublyLinkedList<int>>(outFile, "DoublyLinkedList");
+
+    DoublyLinkedList<int> doubly(items, 5);
+    std::vector<int> reversed;
+    for (DoublyLinkedList<int>::ConstIterator it = doubly.end(); it != doubly.begin(); ) {
+        reversed.push_back(*--it);
+    }
+    assert(reversed.size() == 5 && reversed[0] == 5 && reversed[4] == 3);
+    outFile << " ✓" << std::endl;
+
+    // Тест 4: общий итератор Sequence и Concat
+    outFile << "\nTest 4: Sequence iterator and Concat...";
+    Sequence<int>* base = new ImmutableListSequence<int>(items, 5);
+    std::vector<int> viaBase;
+    for (int item : *base) {
+        viaBase.push_back(item);
+    }
+    assert(viaBase.size() == 5 && viaBase[2] == 4);
+
+    Sequence<int>* arrayConcat = sequence.Concat(base);
+    Sequence<int>* listConcat = base->Concat(&sequence);
+    Sequence<int>* selfConcat = sequence.Concat(&sequence);
+    assert(arrayConcat->GetLength() == 10 && listConcat->GetLength() == 10 && selfConcat->GetLength() == 10);
+    for (int i = 0; i < 10; ++i) {
+        assert(arrayConcat->Get(i) == items[i % 5]);
+        assert(listConcat->Get(i) == items[i % 5]);
+        assert(selfConcat->Get(i) == items[i % 5]);
+    }
+    assert(base->GetLength() == 5);
+    outFile << "\n  " << listConcat->ToString();
+    delete arrayConcat;
+    delete listConcat;
+    delete selfConcat;
+    delete base;
+    outFile << " ✓" << std::endl;
+
+    // Тест 5: LinearForm поверх смежных итераторов
+    outFile << "\nTest 5: LinearForm evaluation...";
+    double coefficients[] = {1.0, 2.0, 3.0, 4.0};
+    LinearForm<double> form(coefficients, 4);
+    double variables[] = {1.0, 1.0, 2.0};
+    MutableArraySequence<double> point(variables, 3);
+    assert(form.Evaluate(point) == 1.0 + 2.0 + 3.0 + 8.0);
+    assert(form.Evaluate(2.0) == 1.0 + 4.0 + 12.0 + 32.0);
+    ArraySequence<double>* gradient = form.Gradient();
+    assert(gradient->GetLength() == 3 && gradient->Get(0) == 2.0 && gradient->Get(2) == 4.0);
+    delete gradient;
+    outFile << " ✓" << std::endl;
+
+    outFile << "\n=== All Iterator tests passed successfully! ===" << std::endl;
+
+    outFile.close();
+    std::cout << "Тесты завершены. Результаты записаны в outputIterators.txt" << std::endl;
+}
@@ -0,0 +1,434 @@
+#ifndef PERSISTENT_VECTOR_H
+#define PERSISTENT_VECTOR_H
+
+#include <stdexcept>
+#include <sstream>
+#include <string>
+#include <new>
+#include <utility>
+#include <atomic>
+#include <iterator>
+#include <cstddef>
+#include <type_traits>
+#include "19_MemoryResource.h"
+
+// Персистентный вектор: префиксное дерево с ветвлением 32 и хвостовой блок.
+// Копия вектора - O(1): узлы общие и считают ссылки на себя. Изменение копирует
+// только путь от корня до нужного листа (O(log32 n)), а узлы с единственным
+// владельцем меняет на месте. Get и Set - O(log32 n), PushBack - O(1) в среднем.
+// Счётчики ссылок атомарные, поэтому разные версии можно читать и менять из разных потоков.
+template <class T> class PersistentVector
+    {
+        public:
+            static constexpr int BITS = 5;
+            static constexpr int WIDTH = 1 << BITS;
+            static constexpr int MASK = WIDTH - 1;
+
+        private:
+            struct Node
+                {
+                    std::atomic<int> refs;
+                    Node() : refs(1) {}
+                };
+
+            // Внутренний узел дерева
+            struct Branch : Node
+                {
+                    Node* children[WIDTH];
+                    Branch() {
+                        for (int i = 0; i < WIDTH; ++i) {
+                            children[i] = nullptr;
+                        }
+                    }
+                };
+
+            // Лист: до WIDTH элементов подряд. Листья в дереве всегда полные, неполным бывает только хвост
+            struct Leaf : Node
+                {
+                    int count;
+                    typename std::aligned_storage<sizeof(T), alignof(T)>::type storage[WIDTH];
+
+                    Leaf() : count(0) {}
+
+                    T* Items() { return reinterpret_cast<T*>(storage); }
+                    const T* Items() const { return reinterpret_cast<const T*>(storage); }
+                };
+
+        public:
+            // Внутри листа идёт по массиву, на границе листа заново спускается по дереву
+            class ConstIterator
+                {
+                    public:
+                        typedef std::forward_iterator_tag iterator_category;
+                        typedef T value_type;
+                        typedef std::ptrdiff_t difference_type;
+                        typedef const T* pointer;
+                        typedef const T& reference;
+
+                        ConstIterator(const PersistentVector<T>* vector, int index)
+                            : vector(vector), index(index), items(index < vector->size ? vector->LeafFor(index)->Items() : nullptr) {}
+
+                        const T& operator*() const { return items[index & MASK]; }
+                        const T* operator->() const { return items + (index & MASK); }
+                        ConstIterator& operator++() {
+                            if ((++index & MASK) == 0) {
+                                items = index < vector->size ? vector->LeafFor(index)->Items() : nullptr;
+                            }
+                            return *this;
+                        }
+                        ConstIterator operator++(int) { ConstIterator old = *this; ++*this; return old; }
+                        bool operator==(const ConstIterator& other) const { return index == other.index && vector == other.vector; }
+                        bool operator!=(const ConstIterator& other) const { return !(*this == other); }
+
+                    private:
+                        const PersistentVector<T>* vector;
+                        int index;
+                        const T* items;
+                };
+
+            explicit PersistentVector(MemoryResource* resource = DefaultResource());
+            PersistentVector(const T* items, int count, MemoryResource* resource = DefaultResource());
+            PersistentVector(const PersistentVector<T>& other);
+            PersistentVector(PersistentVector<T>&& other) noexcept;
+
+            ~PersistentVector();
+
+            PersistentVector& operator= (const PersistentVector<T>& other);
+            PersistentVector& operator= (PersistentVector<T>&& other) noexcept;
+
+            const T& Get(int index) const;
+            // Элементы от index до конца его листа лежат подряд: указатель на первый, в count - их число
+            const T* Chunk(int index, int& count) const;
+            int GetSize() const;
+            MemoryResource* GetResource() const;
+
+            void Set(int index, T value);
+            void PushBack(T item);
+            // Вставка не в конец дерево не поддерживает: вектор собирается заново за O(n)
+            void InsertAt(int index, T item);
+            // Диапазон вставляется за одну пересборку, в конец - через PushBack
+            template <class InputIt> void InsertRange(int index, InputIt first, InputIt last);
+            std::string ToString() const;
+
+            ConstIterator begin() const;
+            ConstIterator end() const;
+
+        private:
+            Node* root;     // Branch или nullptr, пока все элементы помещаются в хвост
+            Leaf* tail;
+            int size;
+            int shift;      // уровень корня: BITS * высота дерева, листья на уровне 0
+            MemoryResource* resource;
+
+            int TailOffset() const;
+            const Leaf* LeafFor(int index) const;
+
+            Branch* UniqueBranch(Branch* branch, int level);
+            Leaf* UniqueLeaf(Leaf* leaf);
+            Node* NewPath(int level, Leaf* leaf);
+            void PushLeaf(Branch* parent, int level, int index, Leaf* leaf);
+            void Release(Node* node, int level);
+            void Swap(PersistentVector<T>& other) noexcept;
+    };
+
+template <class T> constexpr int PersistentVector<T>::BITS;
+template <class T> constexpr int PersistentVector<T>::WIDTH;
+template <class T> constexpr int PersistentVector<T>::MASK;
+
+////////////////////////////////////////////////////////////////////////////
+
+template <class T> PersistentVector<T>::PersistentVector(MemoryResource* resource)
+    : root(nullptr), tail(nullptr), size(0), shift(BITS), resource(resource) {}
+
+template <class T> PersistentVector<T>::PersistentVector(const T* items, int count, MemoryResource* resource)
+    : PersistentVector(resource) {
+    if (count < 0) {
+        throw std::invalid_argument("Invalid size");
+    }
+    for (int i = 0; i < count; ++i) {
+        PushBack(items[i]);
+    }
+}
+
+template <class T> PersistentVector<T>::PersistentVector(const PersistentVector<T>& other)
+    : root(other.root), tail(other.tail), size(other.size), shift(other.shift), resource(other.resource) {
+    if (root != nullptr) root->refs.fetch_add(1, std::memory_order_relaxed);
+    if (tail != nullptr) tail->refs.fetch_add(1, std::memory_order_relaxed);
+}
+
+template <class T> PersistentVector<T>::PersistentVector(PersistentVector<T>&& other) noexcept
+    : root(other.root), tail(other.tail), size(other.size), shift(other.shift), resource(other.resource) {
+    other.root = nullptr;
+    other.tail = nullptr;
+    other.size = 0;
+    other.shift = BITS;
+}
+
+template <class T> PersistentVector<T>::~PersistentVector() {
+    Release(root, shift);
+    Release(tail, 0);
+}
+
+template <class T> void PersistentVector<T>::Swap(PersistentVector<T>& other) noexcept {
+    std::swap(root, other.root);
+    std::swap(tail, other.tail);
+    std::swap(size, other.size);
+    std::swap(shift, other.shift);
+    std::swap(resource, other.resource);
+}
+
+template <class T> PersistentVector<T>& PersistentVector<T>::operator=(const PersistentVector<T>& other) {
+    PersistentVector<T> copy(other);
+    Swap(copy);
+    return *this;
+}
+
+template <class T> PersistentVector<T>& PersistentVector<T>::operator=(PersistentVector<T>&& other) noexcept {
+    PersistentVector<T> moved(std::move(other));
+    Swap(moved);
+    return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+template <class T> void PersistentVector<T>::Release(Node* node, int level) {
+    if (node == nullptr || node->refs.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+        return;
+    }
+
+    if (level == 0) {
+        Leaf* leaf = static_cast<Leaf*>(node);
+        for (int i = 0; i < leaf->count; ++i) {
+            leaf->Items()[i].~T();
+        }
+        DeleteObject(resource, leaf);
+    }
+    else {
+        Branch* branch = static_cast<Branch*>(node);
+        for (int i = 0; i < WIDTH; ++i) {
+            Release(branch->children[i], level - BITS);
+        }
+        DeleteObject(resource, branch);
+    }
+}
+
+// Узел, который можно менять на месте: сам узел, если он ни с кем не делится, иначе его копия
+template <class T> typename PersistentVector<T>::Branch* PersistentVector<T>::UniqueBranch(Branch* branch, int level) {
+    if (branch->refs.load(std::memory_order_acquire) == 1) {
+        return branch;
+    }
+
+    Branch* copy = NewObject<Branch>(resource);
+    for (int i = 0; i < WIDTH; ++i) {
+        copy->children[i] = branch->children[i];
+        if (copy->children[i] != nullptr) {
+            copy->children[i]->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    Release(branch, level);
+    return copy;
+}
+
+template <class T> typename PersistentVector<T>::Leaf* PersistentVector<T>::UniqueLeaf(Leaf* leaf) {
+    if (leaf->refs.load(std::memory_order_acquire) == 1) {
+        return leaf;
+    }
+
+    Leaf* copy = NewObject<Leaf>(resource);
+    try {
+        for (; copy->count < leaf->count; ++copy->count) {
+            new (copy->Items() + copy->count) T(leaf->Items()[copy->count]);
+        }
+    } catch (...) {
+        Release(copy, 0);
+        throw;
+    }
+    Release(leaf, 0);
+    return copy;
+}
+
+template <class T> typename PersistentVector<T>::Node* PersistentVector<T>::NewPath(int level, Leaf* leaf) {
+    if (level == 0) {
+        return leaf;
+    }
+    Branch* branch = NewObject<Branch>(resource);
+    branch->children[0] = NewPath(level - BITS, leaf);
+    return branch;
+}
+
+// Кладёт полный лист на позицию index; parent уже принадлежит только этому вектору
+template <class T> void PersistentVector<T>::PushLeaf(Branch* parent, int level, int index, Leaf* leaf) {
+    int slot = (index >> level) & MASK;
+    if (level == BITS) {
+        parent->children[slot] = leaf;
+    }
+    else if (parent->children[slot] == nullptr) {
+        parent->children[slot] = NewPath(level - BITS, leaf);
+    }
+    else {
+        Branch* child = UniqueBranch(static_cast<Branch*>(parent->children[slot]), level - BITS);
+        parent->children[slot] = child;
+        PushLeaf(child, level - BITS, index, leaf);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+template <class T> int PersistentVector<T>::TailOffset() const {
+    return size - (tail != nullptr ? tail->count : 0);
+}
+
+template <class T> const typename PersistentVector<T>::Leaf* PersistentVector<T>::LeafFor(int index) const {
+    if (index >= TailOffset()) {
+        return tail;
+    }
+
+    const Node* node = root;
+    for (int level = shift; level > 0; level -= BITS) {
+        node = static_cast<const Branch*>(node)->children[(index >> level) & MASK];
+    }
+    return static_cast<const Leaf*>(node);
+}
+
+template <class T> const T& PersistentVector<T>::Get(int index) const {
+    if (index < 0 || index >= size) {
+        throw std::out_of_range("Index out of range");
+    }
+    return LeafFor(index)->Items()[index & MASK];
+}
+
+template <class T> const T* PersistentVector<T>::Chunk(int index, int& count) const {
+    if (index < 0 || index >= size) {
+        throw std::out_of_range("Index out of range");
+    }
+    const Leaf* leaf = LeafFor(index);
+    count = leaf->count - (index & MASK);
+    return leaf->Items() + (index & MASK);
+}
+
+template <class T> int PersistentVector<T>::GetSize() const {
+    return size;
+}
+
+template <class T> MemoryResource* PersistentVector<T>::GetResource() const {
+    return resource;
+}
+
+template <class T> typename PersistentVector<T>::ConstIterator PersistentVector<T>::begin() const {
+    return ConstIterator(this, 0);
+}
+
+template <class T> typename PersistentVector<T>::ConstIterator PersistentVector<T>::end() const {
+    return ConstIterator(this, size);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+template <class T> void PersistentVector<T>::Set(int index, T value) {
+    if (index < 0 || index >= size) {
+        throw std::out_of_range("Index out of range");
+    }
+
+    if (index >= TailOffset()) {
+        tail = UniqueLeaf(tail);
+        tail->Items()[index & MASK] = std::move(value);
+        return;
+    }
+
+    // Копируем путь от корня: все узлы на нём после этого принадлежат только нам
+    Branch* node = UniqueBranch(static_cast<Branch*>(root), shift);
+    root = node;
+    for (int level = shift; level > BITS; level -= BITS) {
+        int slot = (index >> level) & MASK;
+        Branch* child = UniqueBranch(static_cast<Branch*>(node->children[slot]), level - BITS);
+        node->children[slot] = child;
+        node = child;
+    }
+    int slot = (index >> BITS) & MASK;
+    Leaf* leaf = UniqueLeaf(static_cast<Leaf*>(node->children[slot]));
+    node->children[slot] = leaf;
+    leaf->Items()[index & MASK] = std::move(value);
+}
+
+template <class T> void PersistentVector<T>::PushBack(T item) {
+    if (tail != nullptr && tail->count == WIDTH) {
+        // Полный хвост уходит в дерево
+        int offset = size - WIDTH;
+        if (root == nullptr) {
+            root = NewObject<Branch>(resource);
+            shift = BITS;
+        }
+        else if ((offset >> BITS) >= (1 << shift)) {
+            Branch* newRoot = NewObject<Branch>(resource);
+            newRoot->children[0] = root;
+            root = newRoot;
+            shift += BITS;
+        }
+        Branch* unique = UniqueBranch(static_cast<Branch*>(root), shift);
+        root = unique;
+        PushLeaf(unique, shift, offset, tail);
+        tail = nullptr;
+    }
+
+    tail = tail == nullptr ? NewObject<Leaf>(resource) : UniqueLeaf(tail);
+    new (tail->Items() + tail->count) T(std::move(item));
+    ++tail->count;
+    ++size;
+}
+
+template <class T> void PersistentVector<T>::InsertAt(int index, T item) {
+    if (index < 0 || index > size) {
+        throw std::out_of_range("Index out of range");
+    }
+    if (index == size) {
+        PushBack(std::move(item));
+        return;
+    }
+
+    PersistentVector<T> result(resource);
+    int position = 0;
+    for (const T& current : *this) {
+        if (position++ == index) {
+            result.PushBack(std::move(item));
+        }
+        result.PushBack(current);
+    }
+    Swap(result);
+}
+
+template <class T> template <class InputIt> void PersistentVector<T>::InsertRange(int index, InputIt first, InputIt last) {
+    if (index < 0 || index > size) {
+        throw std::out_of_range("Index out of range");
+    }
+    if (index == size) {
+        for (; first != last; ++first) {
+            PushBack(*first);
+        }
+        return;
+    }
+
+    PersistentVector<T> result(resource);
+    int position = 0;
+    for (const T& current : *this) {
+        if (position++ == index) {
+            for (; first != last; ++first) {
+                result.PushBack(*first);
+            }
+        }
+        result.PushBack(current);
+    }
+    Swap(result);
+}
+
+template <class T> std::string PersistentVector<T>::ToString() const {
+    std::ostringstream oss;
+    oss << "[";
+    for (ConstIterator it = begin(); it != end(); ) {
+        oss << *it;
+        if (++it != end()) oss << ", ";
+    }
+    oss << "]";
+    return oss.str();
+}
+
+#endif
@@ -0,0 +1,153 @@
+#include "1_ArraySequence.h"
+#include "27_PersistentVector.h"
+#include <iostream>
+#include <fstream>
+#include <cassert>
+#include <string>
+#include <thread>
+#include <vector>
+
+void testPersistentVector() {
+    std::ofstream outFile("outputPersistent.txt");
+    if (!outFile) {
+        std::cerr << "Не удалось открыть файл outputPersistent.txt для записи" << std::endl;
+        return;
+    }
+
+    outFile << "=== Starting PersistentVector tests ===" << std::endl;
+
+    // Тест 1: PushBack и Get через границы хвоста и уровней дерева
+    outFile << "\nTest 1: PushBack / Get across tree levels...";
+    PersistentVector<int> vector;
+    const int n = 40000;
+    for (int i = 0; i < n; ++i) {
+        vector.PushBack(i * 3);
+    }
+    assert(vector.GetSize() == n);
+    for (int i = 0; i < n; ++i) {
+        assert(vector.Get(i) == i * 3);
+    }
+    int expected = 0;
+    for (int item : vector) {
+        assert(item == expected);
+        expected += 3;
+    }
+    assert(expected == n * 3);
+    outFile << " size = " << vector.GetSize() << " ✓" << std::endl;
+
+    // Тест 2: версии не влияют друг на друга
+    outFile << "\nTest 2: Structural sharing...";
+    PersistentVector<int> copy(vector);
+    copy.Set(0, -1);
+    copy.Set(n / 2, -2);
+    copy.Set(n - 1, -3);
+    copy.PushBack(-4);
+    assert(vector.Get(0) == 0 && vector.Get(n / 2) == n / 2 * 3 && vector.Get(n - 1) == (n - 1) * 3);
+    assert(vector.GetSize() == n);
+    assert(copy.Get(0) == -1 && copy.Get(n / 2) == -2 && copy.Get(n - 1) == -3 && copy.Get(n) == -4);
+
+    std::vector<PersistentVector<std::string>> versions;
+    PersistentVector<std::string> words;
+    for (int i = 0; i < 100; ++i) {
+        versions.push_back(words);
+        words.PushBack(std::to_string(i));
+    }
+    for (int i = 0; i < 100; ++i) {
+        assert(versions[i].GetSize() == i);
+        if (i > 0) {
+            assert(versions[i].Get(i - 1) == std::to_string(i - 1));
+        }
+    }
+    words.InsertAt(50, "x");
+    assert(words.Get(50) == "x" && words.Get(51) == "50" && words.GetSize() == 101);
+    assert(versions[99].Get(50) == "50");
+    outFile << " ✓" << std::endl;
+
+    // Тест 3: ImmutableArraySequence поверх персистентного вектора
+    outFile << "\nTest 3: ImmutableArraySequence versions...";
+    std::vector<ArraySequence<int>*> history;
+    history.push_back(new ImmutableArraySequence<int>());
+    for (int i = 0; i < 2000; ++i) {
+        history.push_back(history.back()->Append(i));
+    }
+    for (int i = 0; i <= 2000; i += 250) {
+        assert(history[i]->GetLength() == i);
+        if (i > 0) {
+            assert(history[i]->GetLast() == i - 1);
+        }
+    }
+    ArraySequence<int>* last = history.back();
+    long sum = 0;
+    for (int item : *last) {
+        sum += item;
+    }
+    assert(sum == 1999L * 2000 / 2);
+
+    // Обход идёт по листьям дерева, ничего не копируя, поэтому одну версию можно читать из нескольких потоков
+    std::vector<long> sums(4, 0);
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([last, &sums, t]() {
+            for (int item : *last) {
+                sums[t] += item;
+            }
+        });
+    }
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+    for (long threadSum : sums) {
+        assert(threadSum == sum);
+    }
+    ArraySequence<int>* across = last->GetSubsequence(20, 1500);
+    assert(across->GetLength() == 1481 && across->Get(12) == 32 && across->GetLast() == 1500);
+    delete across;
+
+    ArraySequence<int>* prepended = history[3]->Prepend(-1);
+    ArraySequence<int>* inserted = prepended->InsertAt(7, 2);
+    ArraySequence<int>* emplaced = inserted->EmplaceBack(9);
+    assert(prepended->ToString() == "[-1, 0, 1, 2]");
+    assert(inserted->ToString() == "[-1, 0, 7, 1, 2]");
+    assert(emplaced->ToString() == "[-1, 0, 7, 1, 2, 9]");
+    assert(history[3]->ToString() == "[0, 1, 2]");
+
+    ArraySequence<int>* sub = last->GetSubsequence(1000, 1009);
+    assert(sub->GetLength() == 10 && sub->GetFirst() == 1000 && sub->GetLast() == 1009);
+    ArraySequence<int>* concat = emplaced->Concat(history[2]);
+    assert(concat->ToString() == "[-1, 0, 7, 1, 2, 9, 0, 1]");
+    outFile << "\n  " << concat->ToString();
+
+    delete concat;
+    delete sub;
+    delete emplaced;
+    delete inserted;
+    delete prepended;
+    for (ArraySequence<int>* version : history) {
+        delete version;
+    }
+    outFile << " ✓" << std::endl;
+
+    // Тест 4: исключения
+    outFile << "\nTest 4: Exceptions...";
+    bool thrown = false;
+    try {
+        vector.Get(n);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    thrown = false;
+    try {
+        ImmutableArraySequence<int> empty;
+        empty.GetFirst();
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    outFile << " ✓" << std::endl;
+
+    outFile << "\n=== All PersistentVector tests passed successfully! ===" << std::endl;
+
+    outFile.close();
+    std::cout << "Тесты завершены. Результаты записаны в outputPersistent.txt" << std::endl;
+}
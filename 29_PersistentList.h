@@ -0,0 +1,514 @@
+#ifndef PERSISTENT_LIST_H
+#define PERSISTENT_LIST_H
+
+#include <stdexcept>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <atomic>
+#include <iterator>
+#include <cstddef>
+#include "19_MemoryResource.h"
+#include "3_DynamicArray.h"
+
+// Персистентный список: узлы не меняются после создания и считают ссылки на себя,
+// поэтому копия списка - O(1), а версии делят общие части. Элементы хранятся как
+// front ++ reverse(rear): Prepend кладёт узел в начало front, Append - в начало rear,
+// оба за O(1). Вставка и удаление в середине копируют только узлы до нужной позиции.
+// Интерфейс LinkedList сохранён, это хранилище ImmutableListSequence по умолчанию.
+template <class T> class PersistentList
+    {
+        private:
+            struct Node
+                {
+                    T data;
+                    Node* next;
+                    std::atomic<int> refs;
+                    Node(T data, Node* next) : data(std::move(data)), next(next), refs(1) {}
+                };
+
+        public:
+            // Сначала идёт по front, потом по узлам rear в порядке элементов. Порядок rear
+            // итератор собирает себе сам при создании, так что список он только читает
+            class ConstIterator
+                {
+                    public:
+                        typedef std::forward_iterator_tag iterator_category;
+                        typedef T value_type;
+                        typedef std::ptrdiff_t difference_type;
+                        typedef const T* pointer;
+                        typedef const T& reference;
+
+                        const T& operator*() const { return node != nullptr ? node->data : rearNodes.Data()[rearIndex]->data; }
+                        const T* operator->() const { return &**this; }
+                        ConstIterator& operator++() {
+                            if (node != nullptr) node = node->next;
+                            else ++rearIndex;
+                            return *this;
+                        }
+                        ConstIterator operator++(int) { ConstIterator old = *this; ++*this; return old; }
+                        bool operator==(const ConstIterator& other) const { return node == other.node && rearIndex == other.rearIndex; }
+                        bool operator!=(const ConstIterator& other) const { return !(*this == other); }
+
+                    private:
+                        friend class PersistentList<T>;
+                        const Node* node;
+                        int rearIndex;
+                        // Копия итератора делит этот буфер (copy-on-write), а не копирует его
+                        DynamicArray<const Node*> rearNodes;
+
+                        ConstIterator(const Node* node, int rearIndex, DynamicArray<const Node*>&& rearNodes)
+                            : node(node), rearIndex(rearIndex), rearNodes(std::move(rearNodes)) {}
+                };
+
+            explicit PersistentList(MemoryResource* resource = DefaultResource());
+            PersistentList(T* items, int count, MemoryResource* resource = DefaultResource());
+            PersistentList(const PersistentList<T>& list);
+            PersistentList(const PersistentList<T>& list, MemoryResource* resource);
+
+            ~PersistentList();
+
+            T GetFirst() const;
+            T GetLast() const;
+            T Get(int index) const;
+            PersistentList<T>* GetSubList(int startIndex, int endIndex) const;
+            int GetLength() const;
+
+            void Append(T item);
+            void Prepend(T item);
+            void InsertAt(T item, int index);
+            template <class InputIt> void InsertRange(int index, InputIt first, InputIt last);
+            T RemoveFirst();
+            T RemoveLast();
+            T RemoveAt(int index);
+            PersistentList<T>* Concat(PersistentList<T>* list) const;
+            PersistentList& operator= (const PersistentList<T>& list);
+            std::string ToString() const;
+            MemoryResource* GetResource() const;
+
+            ConstIterator begin() const;
+            ConstIterator end() const;
+
+        private:
+            Node* front;
+            Node* frontLast;    // последний узел front, для GetLast при пустом rear
+            Node* rear;         // rear хранится в обратном порядке: rear - последний элемент
+            int frontSize;
+            int rearSize;
+            MemoryResource* resource;
+
+            static Node* Retain(Node* node);
+            void Release(Node* node);
+            static Node* Advance(Node* node, int steps);
+            Node* CopyPrefix(Node* chain, int count, Node* rest, Node** last);
+            Node* InsertInto(Node* chain, int position, T&& item, Node** inserted);
+            Node* RemoveFrom(Node* chain, int position, Node** last);
+            void Normalize();
+            void Share(const PersistentList<T>& list);
+            void Clear();
+    };
+
+////////////////////////////////////////////////////////////////////////////
+
+template <class T> PersistentList<T>::PersistentList(MemoryResource* resource)
+    : front(nullptr), frontLast(nullptr), rear(nullptr), frontSize(0), rearSize(0), resource(resource) {}
+
+template <class T> PersistentList<T>::PersistentList(T* items, int count, MemoryResource* resource) : PersistentList(resource) {
+    for (int i = 0; i < count; ++i) {
+        Append(items[i]);
+    }
+}
+
+template <class T> PersistentList<T>::PersistentList(const PersistentList<T>& list) : PersistentList(list, list.resource) {}
+
+template <class T> PersistentList<T>::PersistentList(const PersistentList<T>& list, MemoryResource* resource) : PersistentList(resource) {
+    // Узлы можно делить только со списком из того же ресурса: освобождает их последний владелец
+    if (resource == list.resource) {
+        Share(list);
+    }
+    else {
+        for (const T& item : list) {
+            Append(item);
+        }
+    }
+}
+
+template <class T> PersistentList<T>::~PersistentList() {
+    Clear();
+}
+
+template <class T> void PersistentList<T>::Share(const PersistentList<T>& list) {
+    front = Retain(list.front);
+    frontLast = list.frontLast;
+    rear = Retain(list.rear);
+    frontSize = list.frontSize;
+    rearSize = list.rearSize;
+}
+
+template <class T> void PersistentList<T>::Clear() {
+    Release(front);
+    Release(rear);
+    front = frontLast = rear = nullptr;
+    frontSize = rearSize = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+template <class T> typename PersistentList<T>::Node* PersistentList<T>::Retain(Node* node) {
+    if (node != nullptr) {
+        node->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+    return node;
+}
+
+// Освобождает цепочку, пока узлы не принадлежат кому-то ещё
+template <class T> void PersistentList<T>::Release(Node* node) {
+    while (node != nullptr && node->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        Node* next = node->next;
+        DeleteObject(resource, node);
+        node = next;
+    }
+}
+
+template <class T> typename PersistentList<T>::Node* PersistentList<T>::Advance(Node* node, int steps) {
+    for (; steps > 0; --steps) {
+        node = node->next;
+    }
+    return node;
+}
+
+// Копии первых count узлов chain, за которыми идёт rest. Ссылка на rest переходит к результату.
+// В last - последняя копия (nullptr при count == 0)
+template <class T> typename PersistentList<T>::Node* PersistentList<T>::CopyPrefix(Node* chain, int count, Node* rest, Node** last) {
+    Node* head = nullptr;
+    Node* tail = nullptr;
+    try {
+        for (; count > 0; --count, chain = chain->next) {
+            Node* copy = NewObject<Node>(resource, chain->data, nullptr);
+            if (head == nullptr) head = copy;
+            else tail->next = copy;
+            tail = copy;
+        }
+    } catch (...) {
+        Release(head);
+        Release(rest);
+        throw;
+    }
+
+    if (last != nullptr) *last = tail;
+    if (tail == nullptr) return rest;
+    tail->next = rest;
+    return head;
+}
+
+template <class T> typename PersistentList<T>::Node* PersistentList<T>::InsertInto(Node* chain, int position, T&& item, Node** inserted) {
+    Node* rest = Retain(Advance(chain, position));
+    Node* node;
+    try {
+        node = NewObject<Node>(resource, std::move(item), rest);
+    } catch (...) {
+        Release(rest);
+        throw;
+    }
+    *inserted = node;
+    return CopyPrefix(chain, position, node, nullptr);
+}
+
+template <class T> typename PersistentList<T>::Node* PersistentList<T>::RemoveFrom(Node* chain, int position, Node** last) {
+    Node* rest = Retain(Advance(chain, position)->next);
+    return CopyPrefix(chain, position, rest, last);
+}
+
+// front пуст только у пустого списка: иначе переносим rear в front
+template <class T> void PersistentList<T>::Normalize() {
+    if (front != nullptr || rear == nullptr) {
+        return;
+    }
+
+    Node* reversed = nullptr;
+    Node* last = nullptr;
+    try {
+        for (Node* node = rear; node != nullptr; node = node->next) {
+            reversed = NewObject<Node>(resource, node->data, reversed);
+            if (last == nullptr) last = reversed;
+        }
+    } catch (...) {
+        Release(reversed);
+        throw;
+    }
+
+    Release(rear);
+    front = reversed;
+    frontLast = last;
+    frontSize = rearSize;
+    rear = nullptr;
+    rearSize = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+template <class T> T PersistentList<T>::GetFirst() const {
+    if (front == nullptr) {
+        throw std::out_of_range("List is empty");
+    }
+    return front->data;
+}
+
+template <class T> T PersistentList<T>::GetLast() const {
+    if (front == nullptr) {
+        throw std::out_of_range("List is empty");
+    }
+    return rear != nullptr ? rear->data : frontLast->data;
+}
+
+template <class T> T PersistentList<T>::Get(int index) const {
+    if (index < 0 || index >= frontSize + rearSize) {
+        throw std::out_of_range("Index out of range");
+    }
+
+    // rear лежит с конца списка, поэтому позиция в нём отсчитывается от последнего элемента
+    if (index >= frontSize) {
+        return Advance(rear, GetLength() - 1 - index)->data;
+    }
+    if (index == frontSize - 1) {
+        return frontLast->data;
+    }
+    return Advance(front, index)->data;
+}
+
+template <class T> PersistentList<T>* PersistentList<T>::GetSubList(int startIndex, int endIndex) const {
+    if (startIndex < 0 || endIndex >= GetLength() || startIndex > endIndex) {
+        throw std::out_of_range("Invalid index range");
+    }
+
+    PersistentList<T>* subList = new PersistentList<T>(resource);
+    int position = 0;
+    for (const T& item : *this) {
+        if (position > endIndex) break;
+        if (position++ >= startIndex) subList->Append(item);
+    }
+    return subList;
+}
+
+template <class T> int PersistentList<T>::GetLength() const {
+    return frontSize + rearSize;
+}
+
+template <class T> MemoryResource* PersistentList<T>::GetResource() const {
+    return resource;
+}
+
+template <class T> typename PersistentList<T>::ConstIterator PersistentList<T>::begin() const {
+    // Буфер итератора - из DefaultResource: одну версию могут читать несколько потоков,
+    // а ресурс списка (арена, пул) не обязан быть потокобезопасным
+    DynamicArray<const Node*> rearNodes(rearSize);
+    int position = rearSize;
+    for (const Node* node = rear; node != nullptr; node = node->next) {
+        rearNodes.Set(--position, node);
+    }
+    return ConstIterator(front, 0, std::move(rearNodes));
+}
+
+template <class T> typename PersistentList<T>::ConstIterator PersistentList<T>::end() const {
+    return ConstIterator(nullptr, rearSize, DynamicArray<const Node*>(0));
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+template <class T> void PersistentList<T>::Prepend(T item) {
+    front = NewObject<Node>(resource, std::move(item), front);
+    if (frontLast == nullptr) frontLast = front;
+    frontSize++;
+}
+
+template <class T> void PersistentList<T>::Append(T item) {
+    if (front == nullptr) {
+        Prepend(std::move(item));
+        return;
+    }
+    rear = NewObject<Node>(resource, std::move(item), rear);
+    rearSize++;
+}
+
+template <class T> void PersistentList<T>::InsertAt(T item, int index) {
+    if (index < 0 || index > GetLength()) {
+        throw std::out_of_range("Index out of range");
+    }
+
+    if (index == 0) {
+        Prepend(std::move(item));
+    }
+    else if (index == GetLength()) {
+        Append(std::move(item));
+    }
+    else if (index <= frontSize) {
+        Node* inserted;
+        Node* newFront = InsertInto(front, index, std::move(item), &inserted);
+        Release(front);
+        front = newFront;
+        if (index == frontSize) frontLast = inserted;
+        frontSize++;
+    }
+    else {
+        // В rear позиция считается с конца списка
+        Node* inserted;
+        Node* newRear = InsertInto(rear, GetLength() - index, std::move(item), &inserted);
+        Release(rear);
+        rear = newRear;
+        rearSize++;
+    }
+}
+
+// Новые узлы создаются один раз и подцепляются к хвосту списка за местом вставки,
+// копируются только узлы перед ним - как в InsertAt, но один раз на весь диапазон.
+// Вставка в rear (в том числе в конец) собирает цепочку в обратном порядке
+template <class T> template <class InputIt> void PersistentList<T>::InsertRange(int index, InputIt first, InputIt last) {
+    if (index < 0 || index > GetLength()) {
+        throw std::out_of_range("Index out of range");
+    }
+
+    bool intoFront = index == 0 || (index <= frontSize && index < GetLength());
+    Node* chainHead = nullptr;
+    Node* chainTail = nullptr;
+    int count = 0;
+    try {
+        for (; first != last; ++first, ++count) {
+            if (intoFront) {
+                Node* node = NewObject<Node>(resource, *first, nullptr);
+                if (chainHead == nullptr) chainHead = node;
+                else chainTail->next = node;
+                chainTail = node;
+            }
+            else {
+                chainHead = NewObject<Node>(resource, *first, chainHead);
+                if (chainTail == nullptr) chainTail = chainHead;
+            }
+        }
+    } catch (...) {
+        Release(chainHead);
+        throw;
+    }
+    if (count == 0) {
+        return;
+    }
+
+    if (intoFront) {
+        chainTail->next = Retain(Advance(front, index));
+        Node* newFront = CopyPrefix(front, index, chainHead, nullptr);
+        Release(front);
+        front = newFront;
+        if (index == frontSize) frontLast = chainTail;
+        frontSize += count;
+    }
+    else {
+        int position = GetLength() - index;
+        chainTail->next = Retain(Advance(rear, position));
+        Node* newRear = CopyPrefix(rear, position, chainHead, nullptr);
+        Release(rear);
+        rear = newRear;
+        rearSize += count;
+    }
+}
+
+template <class T> T PersistentList<T>::RemoveFirst() {
+    if (front == nullptr) {
+        throw std::out_of_range("List is empty");
+    }
+
+    T value = front->data;
+    Node* next = Retain(front->next);
+    Release(front);
+    front = next;
+    if (--frontSize == 0) frontLast = nullptr;
+    Normalize();
+    return value;
+}
+
+template <class T> T PersistentList<T>::RemoveLast() {
+    if (front == nullptr) {
+        throw std::out_of_range("List is empty");
+    }
+    if (rear == nullptr) {
+        return RemoveAt(frontSize - 1);
+    }
+
+    T value = rear->data;
+    Node* next = Retain(rear->next);
+    Release(rear);
+    rear = next;
+    rearSize--;
+    return value;
+}
+
+template <class T> T PersistentList<T>::RemoveAt(int index) {
+    if (index < 0 || index >= GetLength()) {
+        throw std::out_of_range("Index out of range");
+    }
+    if (index == 0) {
+        return RemoveFirst();
+    }
+
+    if (index < frontSize) {
+        T value = Advance(front, index)->data;
+        Node* last;
+        Node* newFront = RemoveFrom(front, index, &last);
+        Release(front);
+        front = newFront;
+        if (index == frontSize - 1) frontLast = last;
+        frontSize--;
+        return value;
+    }
+
+    int position = GetLength() - 1 - index;
+    T value = Advance(rear, position)->data;
+    Node* newRear = RemoveFrom(rear, position, nullptr);
+    Release(rear);
+    rear = newRear;
+    rearSize--;
+    return value;
+}
+
+template <class T> PersistentList<T>* PersistentList<T>::Concat(PersistentList<T>* list) const {
+    if (list == nullptr) {
+        throw std::invalid_argument("List cannot be null");
+    }
+
+    PersistentList<T>* newList = new PersistentList<T>(*this);
+    for (const T& item : *list) {
+        newList->Append(item);
+    }
+    return newList;
+}
+
+template <class T> PersistentList<T>& PersistentList<T>::operator=(const PersistentList<T>& list) {
+    if (this != &list) {
+        if (resource == list.resource) {
+            // Сначала берём ссылки на чужие узлы, потом отпускаем свои
+            Node* oldFront = front;
+            Node* oldRear = rear;
+            Share(list);
+            Release(oldFront);
+            Release(oldRear);
+        }
+        else {
+            Clear();
+            for (const T& item : list) {
+                Append(item);
+            }
+        }
+    }
+    return *this;
+}
+
+template <class T> std::string PersistentList<T>::ToString() const {
+    std::ostringstream oss;
+    oss << "[";
+    for (ConstIterator it = begin(); it != end(); ) {
+        oss << *it;
+        if (++it != end()) oss << ", ";
+    }
+    oss << "]";
+    return oss.str();
+}
+
+#endif
@@ -1,19 +1,31 @@
 #ifndef LISTSEQUENCE_H
 #define LISTSEQUENCE_H
 
+#include <memory>
 #include "0_Sequence.h"
 #include "4_LinkedList.h"
-
-template <class T> class ListSequence;
-template <class T> class MutableListSequence;
-template <class T> class ImmutableListSequence;
-
-template <class T> class ListSequence : public Sequence<T> 
+#include "21_UnrolledLinkedList.h"
+#include "23_DoublyLinkedList.h"
+#include "29_PersistentList.h"
+#include "31_SequenceView.h"
+
+// List - хранилище элементов: LinkedList<T>, UnrolledLinkedList<T>, DoublyLinkedList<T>
+// или PersistentList<T>. Remove* доступны с DoublyLinkedList<T> и PersistentList<T>,
+// курсоры - только с DoublyLinkedList<T>. ImmutableListSequence по умолчанию лежит
+// на PersistentList<T>: копия при каждом изменении стоит O(1), версии делят узлы.
+template <class T, class List = LinkedList<T>> class ListSequence;
+template <class T, class List = LinkedList<T>> class MutableListSequence;
+template <class T, class List = PersistentList<T>> class ImmutableListSequence;
+
+template <class T, class List> class ListSequence : public Sequence<T> 
     {
         public:
             ListSequence(T* items, int count);
             ListSequence();
-            ListSequence(const LinkedList<T>& linkedList);
+            explicit ListSequence(MemoryResource* resource);
+            ListSequence(const List& linkedList);
+            template <class InputIt, class = typename std::iterator_traits<InputIt>::iterator_category>
+            ListSequence(InputIt first, InputIt last, MemoryResource* resource = DefaultResource());
             
             virtual ~ListSequence();
 
@@ -21,148 +33,265 @@ template <class T> class ListSequence : public Sequence<T>
             T GetLast() const override;
             T Get(int index) const override;
             int GetLength() const override;
-            ListSequence<T>* GetSubsequence(int startIndex, int endIndex) const override;
+            ListSequence<T, List>* GetSubsequence(int startIndex, int endIndex) const override;
+            // Срез без копирования: читает элементы через Get этой последовательности
+            SequenceView<T> GetSubsequenceView(int startIndex, int endIndex) const;
             
-            virtual ListSequence<T>* Instance() = 0;
-            virtual ListSequence<T>* Clone() const = 0;
+            virtual ListSequence<T, List>* Instance() = 0;
+            virtual ListSequence<T, List>* Clone() const = 0;
             
-            ListSequence<T>* Append(T item) override;
-            ListSequence<T>* Prepend(T item) override;
-            ListSequence<T>* InsertAt(T item, int index) override;
-            ListSequence<T>* Concat(Sequence<T>* other) override;
+            ListSequence<T, List>* Append(T item) override;
+            ListSequence<T, List>* Prepend(T item) override;
+            ListSequence<T, List>* InsertAt(T item, int index) override;
+            ListSequence<T, List>* Concat(Sequence<T>* other) override;
             std::string ToString() const;
+
+            // Вставка диапазона за один вызов Instance(): неизменяемая версия копируется один раз
+            template <class InputIt> ListSequence<T, List>* AppendRange(InputIt first, InputIt last);
+            template <class InputIt> ListSequence<T, List>* PrependRange(InputIt first, InputIt last);
+            template <class InputIt> ListSequence<T, List>* InsertRange(int index, InputIt first, InputIt last);
+
+            // Итераторы хранилища: проход по узлам без поиска по индексу
+            typename List::ConstIterator begin() const;
+            typename List::ConstIterator end() const;
+
+            ListSequence<T, List>* RemoveFirst();
+            ListSequence<T, List>* RemoveLast();
+            ListSequence<T, List>* RemoveAt(int index);
             
         protected:
-            LinkedList<T>* list;
-            virtual ListSequence<T>* AppendInternal(T item);
-            virtual ListSequence<T>* PrependInternal(T item);
-            virtual ListSequence<T>* InsertAtInternal(T item, int index);
-            virtual ListSequence<T>* ConcatInternal(Sequence<T>* other);
+            List* list;
+            virtual ListSequence<T, List>* AppendInternal(T item);
+            virtual ListSequence<T, List>* PrependInternal(T item);
+            virtual ListSequence<T, List>* InsertAtInternal(T item, int index);
+            virtual ListSequence<T, List>* ConcatInternal(Sequence<T>* other);
 };
 
 ////////////////////////////////////////////////////////////////////////////////////
 
-template <class T> class MutableListSequence : public ListSequence<T> 
+template <class T, class List> class MutableListSequence : public ListSequence<T, List> 
     {
         public:
-            using ListSequence<T>::ListSequence;
-            ListSequence<T>* Instance() override;
-            ListSequence<T>* Clone() const override;
+            using ListSequence<T, List>::ListSequence;
+            ListSequence<T, List>* Instance() override;
+            ListSequence<T, List>* Clone() const override;
+
+            template <class L = List> typename L::Cursor CursorFirst();
+            template <class L = List> typename L::Cursor CursorLast();
+            template <class L = List> typename L::Cursor CursorAt(int index);
     };
 
-template <class T> class ImmutableListSequence : public ListSequence<T> 
+template <class T, class List> class ImmutableListSequence : public ListSequence<T, List> 
     {
         public:
-            using ListSequence<T>::ListSequence;
-            ListSequence<T>* Instance() override;
-            ListSequence<T>* Clone() const override;
+            using ListSequence<T, List>::ListSequence;
+            ListSequence<T, List>* Instance() override;
+            ListSequence<T, List>* Clone() const override;
     };
 
 //////////////////////////////////////////////////////////////////////////////////////
 
-template <class T>
-ListSequence<T>::ListSequence(T* items, int count) : list(new LinkedList<T>(items, count)) {}
+template <class T, class List>
+ListSequence<T, List>::ListSequence(T* items, int count) : list(new List(items, count)) {}
 
-template <class T>
-ListSequence<T>::ListSequence() : list(new LinkedList<T>()) {}
+template <class T, class List>
+ListSequence<T, List>::ListSequence() : list(new List()) {}
 
-template <class T>
-ListSequence<T>::ListSequence(const LinkedList<T>& linkedList) : list(new LinkedList<T>(linkedList)) {}
+template <class T, class List>
+ListSequence<T, List>::ListSequence(MemoryResource* resource) : list(new List(resource)) {}
 
-template <class T>
-ListSequence<T>::~ListSequence() { delete list; }
+template <class T, class List>
+ListSequence<T, List>::ListSequence(const List& linkedList) : list(new List(linkedList)) {}
+
+template <class T, class List> template <class InputIt, class>
+ListSequence<T, List>::ListSequence(InputIt first, InputIt last, MemoryResource* resource) : list(new List(resource)) {
+    try {
+        for (; first != last; ++first) {
+            list->Append(*first);
+        }
+    } catch (...) {
+        delete list;
+        throw;
+    }
+}
+
+template <class T, class List>
+ListSequence<T, List>::~ListSequence() { delete list; }
 
 ////////////////////////////////////////////////////////////////////////////////////
 
-template <class T> T ListSequence<T>::GetFirst() const {
+template <class T, class List> T ListSequence<T, List>::GetFirst() const {
     return list->GetFirst();
 }
 
-template <class T> T ListSequence<T>::GetLast() const {
+template <class T, class List> T ListSequence<T, List>::GetLast() const {
     return list->GetLast();
 }
 
-template <class T> T ListSequence<T>::Get(int index) const {
+template <class T, class List> T ListSequence<T, List>::Get(int index) const {
     return list->Get(index);
 }
 
-template <class T> int ListSequence<T>::GetLength() const {
+template <class T, class List> typename List::ConstIterator ListSequence<T, List>::begin() const {
+    return list->begin();
+}
+
+template <class T, class List> typename List::ConstIterator ListSequence<T, List>::end() const {
+    return list->end();
+}
+
+template <class T, class List> int ListSequence<T, List>::GetLength() const {
     return list->GetLength();
 }
 
-template <class T> ListSequence<T>* ListSequence<T>::GetSubsequence(int startIndex, int endIndex) const {
-    LinkedList<T>* subList = list->GetSubList(startIndex, endIndex);
-    ListSequence<T>* result = new MutableListSequence<T>(*subList);
-    delete subList;
+template <class T, class List> ListSequence<T, List>* ListSequence<T, List>::GetSubsequence(int startIndex, int endIndex) const {
+    // Забираем готовый список, а не копируем его ещё раз; пока он не отдан результату,
+    // им владеет unique_ptr - на случай исключения из new
+    std::unique_ptr<List> subList(list->GetSubList(startIndex, endIndex));
+    ListSequence<T, List>* result = new MutableListSequence<T, List>(subList->GetResource());
+    delete result->list;
+    result->list = subList.release();
     return result;
 }
 
+template <class T, class List> SequenceView<T> ListSequence<T, List>::GetSubsequenceView(int startIndex, int endIndex) const {
+    if (startIndex < 0 || endIndex >= list->GetLength() || startIndex > endIndex) {
+        throw std::out_of_range("Invalid subsequence range");
+    }
+    return SequenceView<T>(this, startIndex, endIndex - startIndex + 1);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////
 
-template <class T> ListSequence<T>* ListSequence<T>::AppendInternal(T item) {
+template <class T, class List> ListSequence<T, List>* ListSequence<T, List>::AppendInternal(T item) {
     list->Append(item);
     return this;
 }
 
-template <class T> ListSequence<T>* ListSequence<T>::PrependInternal(T item) {
+template <class T, class List> ListSequence<T, List>* ListSequence<T, List>::PrependInternal(T item) {
     list->Prepend(item);
     return this;
 }
 
-template <class T> ListSequence<T>* ListSequence<T>::InsertAtInternal(T item, int index) {
+template <class T, class List> ListSequence<T, List>* ListSequence<T, List>::InsertAtInternal(T item, int index) {
     list->InsertAt(item, index);
     return this;
 }
 
-template <class T> ListSequence<T>* ListSequence<T>::ConcatInternal(Sequence<T>* other) {
+template <class T, class List> ListSequence<T, List>* ListSequence<T, List>::ConcatInternal(Sequence<T>* other) {
     if (!other) throw std::invalid_argument("Other sequence cannot be null");
     
-    ListSequence<T>* result = static_cast<ListSequence<T>*>(this->Clone());
-    
-    for (int i = 0; i < other->GetLength(); i++) {
-        result->Append(other->Get(i));
+    ListSequence<T, List>* result = static_cast<ListSequence<T, List>*>(this->Clone());
+
+    // Добавляем прямо в хранилище копии: Append у неизменяемой копии вернул бы ещё одну копию
+    if (const ListSequence<T, List>* sequence = dynamic_cast<const ListSequence<T, List>*>(other)) {
+        for (const T& item : *sequence) {
+            result->list->Append(item);
+        }
     }
-    
+    else {
+        for (T item : *other) {
+            result->list->Append(item);
+        }
+    }
+
     return result;
 }
 
 //////////////////////////////////////////////////////////////////////////////////////
 
-template <class T> ListSequence<T>* ListSequence<T>::Append(T item) {
+template <class T, class List> ListSequence<T, List>* ListSequence<T, List>::Append(T item) {
     return Instance()->AppendInternal(item);
 }
 
-template <class T> ListSequence<T>* ListSequence<T>::Prepend(T item) {
+template <class T, class List> ListSequence<T, List>* ListSequence<T, List>::Prepend(T item) {
     return Instance()->PrependInternal(item);
 }
 
-template <class T> ListSequence<T>* ListSequence<T>::InsertAt(T item, int index) {
+template <class T, class List> ListSequence<T, List>* ListSequence<T, List>::InsertAt(T item, int index) {
     return Instance()->InsertAtInternal(item, index);
 }
 
-template <class T> ListSequence<T>* ListSequence<T>::Concat(Sequence<T>* other) {
-    return Instance()->ConcatInternal(other);
+template <class T, class List> ListSequence<T, List>* ListSequence<T, List>::Concat(Sequence<T>* other) {
+    // ConcatInternal и так работает с копией, Instance() здесь не нужен
+    return ConcatInternal(other);
+}
+
+template <class T, class List> template <class InputIt> ListSequence<T, List>* ListSequence<T, List>::AppendRange(InputIt first, InputIt last) {
+    return InsertRange(list->GetLength(), first, last);
+}
+
+template <class T, class List> template <class InputIt> ListSequence<T, List>* ListSequence<T, List>::PrependRange(InputIt first, InputIt last) {
+    return InsertRange(0, first, last);
+}
+
+template <class T, class List> template <class InputIt> ListSequence<T, List>* ListSequence<T, List>::InsertRange(int index, InputIt first, InputIt last) {
+    if (index < 0 || index > list->GetLength()) throw std::out_of_range("Index out of range");
+
+    // Список сам собирает новые узлы до того, как меняется, и вставляет их одним куском,
+    // поэтому диапазон может идти и по этому же списку
+    ListSequence<T, List>* result = Instance();
+    try {
+        result->list->InsertRange(index, first, last);
+    } catch (...) {
+        if (result != this) delete result;
+        throw;
+    }
+    return result;
+}
+
+template <class T, class List> ListSequence<T, List>* ListSequence<T, List>::RemoveFirst() {
+    if (list->GetLength() == 0) throw std::out_of_range("Sequence is empty");
+    ListSequence<T, List>* result = Instance();
+    result->list->RemoveFirst();
+    return result;
+}
+
+template <class T, class List> ListSequence<T, List>* ListSequence<T, List>::RemoveLast() {
+    if (list->GetLength() == 0) throw std::out_of_range("Sequence is empty");
+    ListSequence<T, List>* result = Instance();
+    result->list->RemoveLast();
+    return result;
+}
+
+template <class T, class List> ListSequence<T, List>* ListSequence<T, List>::RemoveAt(int index) {
+    if (index < 0 || index >= list->GetLength()) throw std::out_of_range("Index out of range");
+    ListSequence<T, List>* result = Instance();
+    result->list->RemoveAt(index);
+    return result;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////
 
-template <class T> ListSequence<T>* MutableListSequence<T>::Instance() {
+template <class T, class List> ListSequence<T, List>* MutableListSequence<T, List>::Instance() {
     return this;
 }
 
-template <class T> ListSequence<T>* MutableListSequence<T>::Clone() const {
-    return new MutableListSequence<T>(*this->list);
+template <class T, class List> ListSequence<T, List>* MutableListSequence<T, List>::Clone() const {
+    return new MutableListSequence<T, List>(*this->list);
+}
+
+template <class T, class List> template <class L> typename L::Cursor MutableListSequence<T, List>::CursorFirst() {
+    return this->list->CursorFirst();
+}
+
+template <class T, class List> template <class L> typename L::Cursor MutableListSequence<T, List>::CursorLast() {
+    return this->list->CursorLast();
+}
+
+template <class T, class List> template <class L> typename L::Cursor MutableListSequence<T, List>::CursorAt(int index) {
+    return this->list->CursorAt(index);
 }
 
-template <class T> ListSequence<T>* ImmutableListSequence<T>::Instance() {
+template <class T, class List> ListSequence<T, List>* ImmutableListSequence<T, List>::Instance() {
     return this->Clone();
 }
 
-template <class T> ListSequence<T>* ImmutableListSequence<T>::Clone() const {
-    return new ImmutableListSequence<T>(*this->list);
+template <class T, class List> ListSequence<T, List>* ImmutableListSequence<T, List>::Clone() const {
+    return new ImmutableListSequence<T, List>(*this->list);
 }
 
-template <class T> std::string ListSequence<T>::ToString() const {
+template <class T, class List> std::string ListSequence<T, List>::ToString() const {
     return list->ToString();
 }
 
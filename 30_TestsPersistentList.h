@@ -0,0 +1,171 @@
+#include "2_ListSequence.h"
+#include "29_PersistentList.h"
+#include <iostream>
+#include <fstream>
+#include <cassert>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+template <class T> bool sameElements(const PersistentList<T>& list, const std::vector<T>& reference) {
+    if (list.GetLength() != static_cast<int>(reference.size())) return false;
+    int index = 0;
+    for (const T& item : list) {
+        if (item != reference[index] || list.Get(index) != reference[index]) return false;
+        ++index;
+    }
+    return index == list.GetLength();
+}
+
+void testPersistentList() {
+    std::ofstream outFile("outputPersistentList.txt");
+    if (!outFile) {
+        std::cerr << "Не удалось открыть файл outputPersistentList.txt для записи" << std::endl;
+        return;
+    }
+
+    outFile << "=== Starting PersistentList tests ===" << std::endl;
+
+    // Тест 1: случайные операции против std::vector, старые версии не меняются
+    outFile << "\nTest 1: Random operations keep old versions intact...";
+    std::srand(7);
+    PersistentList<int> list;
+    std::vector<int> reference;
+    std::vector<PersistentList<int>> versions;
+    std::vector<std::vector<int>> expected;
+    for (int step = 0; step < 3000; ++step) {
+        int action = std::rand() % 8;
+        int value = std::rand() % 1000;
+        if (action <= 1) {
+            list.Append(value);
+            reference.push_back(value);
+        }
+        else if (action == 2) {
+            list.Prepend(value);
+            reference.insert(reference.begin(), value);
+        }
+        else if (action == 3) {
+            int index = std::rand() % (list.GetLength() + 1);
+            list.InsertAt(value, index);
+            reference.insert(reference.begin() + index, value);
+        }
+        else if (!reference.empty() && action == 4) {
+            assert(list.RemoveFirst() == reference.front());
+            reference.erase(reference.begin());
+        }
+        else if (!reference.empty() && action == 5) {
+            assert(list.RemoveLast() == reference.back());
+            reference.pop_back();
+        }
+        else if (!reference.empty() && action == 6) {
+            int index = std::rand() % list.GetLength();
+            assert(list.RemoveAt(index) == reference[index]);
+            reference.erase(reference.begin() + index);
+        }
+        else {
+            list.Append(value);
+            reference.push_back(value);
+        }
+        if (step % 100 == 0) {
+            versions.push_back(list);
+            expected.push_back(reference);
+        }
+    }
+    assert(sameElements(list, reference));
+    for (size_t i = 0; i < versions.size(); ++i) {
+        assert(sameElements(versions[i], expected[i]));
+    }
+    outFile << " length = " << list.GetLength() << ", versions = " << versions.size() << " ✓" << std::endl;
+
+    // Тест 2: GetFirst / GetLast / GetSubList / Concat / присваивание
+    outFile << "\nTest 2: Access, sublist, concat, assignment...";
+    int items[] = {1, 2, 3, 4, 5};
+    PersistentList<int> small(items, 5);
+    small.Prepend(0);
+    assert(small.GetFirst() == 0 && small.GetLast() == 5);
+    PersistentList<int>* sub = small.GetSubList(2, 4);
+    assert(sub->ToString() == "[2, 3, 4]");
+    PersistentList<int>* joined = small.Concat(sub);
+    assert(joined->ToString() == "[0, 1, 2, 3, 4, 5, 2, 3, 4]");
+    PersistentList<int> assigned;
+    assigned = *joined;
+    delete joined;
+    delete sub;
+    assert(assigned.GetLength() == 9 && assigned.GetLast() == 4);
+
+    // Чтение ничего не меняет в списке: одну версию (front и rear) читают несколько потоков
+    PersistentList<int> shared;
+    for (int i = 0; i < 300; ++i) {
+        if (i % 3 == 0) shared.Prepend(-i);
+        else shared.Append(i);
+    }
+    std::vector<long> sums(4, 0);
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&shared, &sums, t]() {
+            for (int item : shared) {
+                sums[t] += item;
+            }
+            for (int i = t; i < shared.GetLength(); i += 4) {
+                sums[t] += shared.Get(i);
+            }
+        });
+    }
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+    long total = 0;
+    for (int item : shared) {
+        total += item;
+    }
+    assert(sums[0] + sums[1] + sums[2] + sums[3] == 5 * total);
+    outFile << " " << assigned.ToString() << " ✓" << std::endl;
+
+    // Тест 3: ImmutableListSequence - каждая операция даёт новую версию
+    outFile << "\nTest 3: ImmutableListSequence versions...";
+    std::vector<ListSequence<std::string, PersistentList<std::string>>*> history;
+    history.push_back(new ImmutableListSequence<std::string>());
+    for (int i = 0; i < 500; ++i) {
+        ListSequence<std::string, PersistentList<std::string>>* previous = history.back();
+        history.push_back(i % 2 == 0 ? previous->Append(std::to_string(i)) : previous->Prepend(std::to_string(i)));
+    }
+    assert(history[0]->GetLength() == 0);
+    assert(history[1]->ToString() == "[0]");
+    assert(history[2]->ToString() == "[1, 0]");
+    assert(history[3]->ToString() == "[1, 0, 2]");
+    assert(history[500]->GetLength() == 500);
+    assert(history[500]->GetFirst() == "499" && history[500]->GetLast() == "498");
+
+    ListSequence<std::string, PersistentList<std::string>>* removed = history[3]->RemoveAt(1);
+    assert(removed->ToString() == "[1, 2]" && history[3]->ToString() == "[1, 0, 2]");
+    delete removed;
+    for (ListSequence<std::string, PersistentList<std::string>>* version : history) {
+        delete version;
+    }
+    outFile << " ✓" << std::endl;
+
+    // Тест 4: исключения
+    outFile << "\nTest 4: Exceptions...";
+    PersistentList<int> empty;
+    bool thrown = false;
+    try {
+        empty.RemoveLast();
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    thrown = false;
+    try {
+        small.InsertAt(1, 100);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    outFile << " ✓" << std::endl;
+
+    outFile << "\n=== All PersistentList tests passed successfully! ===" << std::endl;
+
+    outFile.close();
+    std::cout << "Тесты завершены. Результаты записаны в outputPersistentList.txt" << std::endl;
+}
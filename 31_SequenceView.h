@@ -0,0 +1,276 @@
+#ifndef SEQUENCE_VIEW_H
+#define SEQUENCE_VIEW_H
+
+#include <algorithm>
+#include <stdexcept>
+#include <sstream>
+#include <string>
+#include <iterator>
+#include <cstddef>
+#include "0_Sequence.h"
+#include "3_DynamicArray.h"
+#include "27_PersistentVector.h"
+
+template <class T> class MutableArraySequence;
+
+// Срез последовательности без копирования элементов.
+// Над массивом view делит буфер DynamicArray (copy-on-write): изменение исходного массива
+// отделит его копию, а view продолжит видеть прежние элементы.
+// Над персистентным вектором (ImmutableArraySequence) view держит копию вектора - O(1),
+// узлы общие - и читает элементы по листьям.
+// Над любой другой последовательностью view хранит указатель на неё и читает через Get;
+// такой view действителен, пока исходная последовательность жива и не меняется.
+// Изменяющие методы view не трогают и возвращают новый MutableArraySequence.
+template <class T> class SequenceView : public Sequence<T>
+    {
+        public:
+            class ConstIterator
+                {
+                    public:
+                        typedef std::input_iterator_tag iterator_category;
+                        typedef T value_type;
+                        typedef std::ptrdiff_t difference_type;
+                        typedef const T* pointer;
+                        typedef T reference;
+
+                        ConstIterator(const SequenceView<T>* view, int index)
+                            : view(view), index(index), item(nullptr), chunkEnd(nullptr) { Load(); }
+
+                        T operator*() const { return item != nullptr ? *item : view->parent->Get(view->offset + index); }
+                        ConstIterator& operator++() {
+                            ++index;
+                            if (item != nullptr && ++item == chunkEnd) Load();
+                            return *this;
+                        }
+                        ConstIterator operator++(int) { ConstIterator old = *this; ++*this; return old; }
+                        bool operator==(const ConstIterator& other) const { return index == other.index && view == other.view; }
+                        bool operator!=(const ConstIterator& other) const { return !(*this == other); }
+
+                    private:
+                        const SequenceView<T>* view;
+                        int index;
+                        // Текущий кусок элементов подряд; nullptr - view читает через Get родителя
+                        const T* item;
+                        const T* chunkEnd;
+
+                        void Load() {
+                            item = chunkEnd = nullptr;
+                            if (index >= view->length || view->parent != nullptr) return;
+                            if (view->data != nullptr) {
+                                item = view->data + index;
+                                chunkEnd = view->data + view->length;
+                            }
+                            else {
+                                int count = 0;
+                                item = view->vector.Chunk(view->offset + index, count);
+                                chunkEnd = item + std::min(count, view->length - index);
+                            }
+                        }
+                };
+
+            SequenceView();
+            SequenceView(const DynamicArray<T>& storage, int offset, int length);
+            SequenceView(const PersistentVector<T>& vector, int offset, int length);
+            SequenceView(const Sequence<T>* parent, int offset, int length);
+            SequenceView(const SequenceView<T>& other);
+
+            SequenceView& operator= (const SequenceView<T>& other);
+
+            T GetFirst() const override;
+            T GetLast() const override;
+            T Get(int index) const override;
+            int GetLength() const override;
+            SequenceView<T>* GetSubsequence(int startIndex, int endIndex) const override;
+            SequenceView<T> Slice(int startIndex, int endIndex) const;
+
+            Sequence<T>* Append(T item) override;
+            Sequence<T>* Prepend(T item) override;
+            Sequence<T>* InsertAt(T item, int index) override;
+            Sequence<T>* Concat(Sequence<T>* other) override;
+            std::string ToString() const override;
+
+            // Собственная копия элементов среза
+            MutableArraySequence<T>* Materialize() const;
+
+            // Элементы подряд в памяти, если view над DynamicArray; иначе nullptr
+            const T* Data() const;
+            ConstIterator begin() const;
+            ConstIterator end() const;
+
+        private:
+            DynamicArray<T> storage;
+            PersistentVector<T> vector;
+            const T* data;
+            const Sequence<T>* parent;
+            int offset;
+            int length;
+
+            void Bind();
+            void CheckRange(int startIndex, int endIndex) const;
+    };
+
+////////////////////////////////////////////////////////////////////////////
+
+template <class T> SequenceView<T>::SequenceView()
+    : storage(0), data(nullptr), parent(nullptr), offset(0), length(0) {}
+
+template <class T> SequenceView<T>::SequenceView(const DynamicArray<T>& storage, int offset, int length)
+    : storage(storage), data(nullptr), parent(nullptr), offset(offset), length(length) {
+    if (offset < 0 || length < 0 || offset + length > storage.GetSize()) {
+        throw std::out_of_range("Invalid view range");
+    }
+    Bind();
+}
+
+template <class T> SequenceView<T>::SequenceView(const PersistentVector<T>& vector, int offset, int length)
+    : storage(0), vector(vector), data(nullptr), parent(nullptr), offset(offset), length(length) {
+    if (offset < 0 || length < 0 || offset + length > vector.GetSize()) {
+        throw std::out_of_range("Invalid view range");
+    }
+}
+
+template <class T> SequenceView<T>::SequenceView(const Sequence<T>* parent, int offset, int length)
+    : storage(0), data(nullptr), parent(parent), offset(offset), length(length) {
+    if (parent == nullptr) {
+        throw std::invalid_argument("Parent sequence cannot be null");
+    }
+    if (offset < 0 || length < 0 || offset + length > parent->GetLength()) {
+        throw std::out_of_range("Invalid view range");
+    }
+}
+
+template <class T> SequenceView<T>::SequenceView(const SequenceView<T>& other)
+    : storage(other.storage), vector(other.vector), data(nullptr), parent(other.parent), offset(other.offset), length(other.length) {
+    Bind();
+}
+
+template <class T> SequenceView<T>& SequenceView<T>::operator=(const SequenceView<T>& other) {
+    storage = other.storage;
+    vector = other.vector;
+    parent = other.parent;
+    offset = other.offset;
+    length = other.length;
+    Bind();
+    return *this;
+}
+
+// Указатель на первый элемент среза в своём буфере. Берётся через константный Data(),
+// чтобы не отделять общий буфер
+template <class T> void SequenceView<T>::Bind() {
+    const DynamicArray<T>& elements = storage;
+    data = parent == nullptr && elements.Data() != nullptr ? elements.Data() + offset : nullptr;
+}
+
+template <class T> void SequenceView<T>::CheckRange(int startIndex, int endIndex) const {
+    if (startIndex < 0 || endIndex >= length || startIndex > endIndex) {
+        throw std::out_of_range("Invalid subsequence range");
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+template <class T> T SequenceView<T>::GetFirst() const {
+    if (length == 0) throw std::out_of_range("Sequence is empty");
+    return Get(0);
+}
+
+template <class T> T SequenceView<T>::GetLast() const {
+    if (length == 0) throw std::out_of_range("Sequence is empty");
+    return Get(length - 1);
+}
+
+template <class T> T SequenceView<T>::Get(int index) const {
+    if (index < 0 || index >= length) {
+        throw std::out_of_range("Index out of range");
+    }
+    if (data != nullptr) return data[index];
+    return parent != nullptr ? parent->Get(offset + index) : vector.Get(offset + index);
+}
+
+template <class T> int SequenceView<T>::GetLength() const {
+    return length;
+}
+
+template <class T> SequenceView<T> SequenceView<T>::Slice(int startIndex, int endIndex) const {
+    CheckRange(startIndex, endIndex);
+    SequenceView<T> result(*this);
+    result.offset += startIndex;
+    result.length = endIndex - startIndex + 1;
+    if (result.data != nullptr) result.data += startIndex;
+    return result;
+}
+
+template <class T> SequenceView<T>* SequenceView<T>::GetSubsequence(int startIndex, int endIndex) const {
+    return new SequenceView<T>(Slice(startIndex, endIndex));
+}
+
+template <class T> const T* SequenceView<T>::Data() const {
+    return data;
+}
+
+template <class T> typename SequenceView<T>::ConstIterator SequenceView<T>::begin() const {
+    return ConstIterator(this, 0);
+}
+
+template <class T> typename SequenceView<T>::ConstIterator SequenceView<T>::end() const {
+    return ConstIterator(this, length);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+template <class T> MutableArraySequence<T>* SequenceView<T>::Materialize() const {
+    MemoryResource* resource = parent != nullptr ? DefaultResource()
+                             : data != nullptr ? storage.GetResource() : vector.GetResource();
+    DynamicArray<T> result(0, resource);
+    result.InsertN(0, begin(), length);
+    return new MutableArraySequence<T>(std::move(result));
+}
+
+template <class T> Sequence<T>* SequenceView<T>::Append(T item) {
+    MutableArraySequence<T>* result = Materialize();
+    result->Append(std::move(item));
+    return result;
+}
+
+template <class T> Sequence<T>* SequenceView<T>::Prepend(T item) {
+    MutableArraySequence<T>* result = Materialize();
+    result->Prepend(std::move(item));
+    return result;
+}
+
+template <class T> Sequence<T>* SequenceView<T>::InsertAt(T item, int index) {
+    MutableArraySequence<T>* result = Materialize();
+    try {
+        result->InsertAt(std::move(item), index);
+    } catch (...) {
+        delete result;
+        throw;
+    }
+    return result;
+}
+
+template <class T> Sequence<T>* SequenceView<T>::Concat(Sequence<T>* other) {
+    if (!other) throw std::invalid_argument("Other sequence cannot be null");
+
+    MutableArraySequence<T>* result = Materialize();
+    result->Reserve(length + other->GetLength());
+    for (T item : *other) {
+        result->Append(std::move(item));
+    }
+    return result;
+}
+
+template <class T> std::string SequenceView<T>::ToString() const {
+    std::ostringstream oss;
+    oss << "[";
+    for (int i = 0; i < length; ++i) {
+        oss << Get(i);
+        if (i < length - 1) oss << ", ";
+    }
+    oss << "]";
+    return oss.str();
+}
+
+#endif
+
+#include "1_ArraySequence.h"
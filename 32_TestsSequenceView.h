@@ -0,0 +1,126 @@
+#include "1_ArraySequence.h"
+#include "2_ListSequence.h"
+#include "31_SequenceView.h"
+#include <iostream>
+#include <fstream>
+#include <cassert>
+#include <numeric>
+#include <string>
+
+void testSequenceView() {
+    std::ofstream outFile("outputView.txt");
+    if (!outFile) {
+        std::cerr << "Не удалось открыть файл outputView.txt для записи" << std::endl;
+        return;
+    }
+
+    outFile << "=== Starting SequenceView tests ===" << std::endl;
+
+    // Тест 1: срез массива делит буфер
+    outFile << "\nTest 1: Array view shares the buffer...";
+    MutableArraySequence<int> numbers;
+    for (int i = 0; i < 100; ++i) {
+        numbers.Append(i);
+    }
+    SequenceView<int> window = numbers.GetSubsequenceView(10, 19);
+    assert(window.GetLength() == 10);
+    assert(window.GetFirst() == 10 && window.GetLast() == 19);
+    assert(window.Data() == numbers.begin() + 10);
+    assert(std::accumulate(window.begin(), window.end(), 0) == 145);
+    outFile << " " << window.ToString() << " ✓" << std::endl;
+
+    // Тест 2: view не меняется вместе с исходным массивом
+    outFile << "\nTest 2: View survives parent mutation...";
+    numbers.Prepend(-1);
+    assert(numbers.Get(11) == 10);
+    assert(window.Get(0) == 10 && window.Data() != numbers.begin() + 10);
+    SequenceView<int> inner = window.Slice(2, 4);
+    assert(inner.ToString() == "[12, 13, 14]");
+    Sequence<int>* sub = window.GetSubsequence(8, 9);
+    assert(sub->GetLength() == 2 && sub->Get(1) == 19);
+    delete sub;
+    outFile << " ✓" << std::endl;
+
+    // Тест 3: срез списка и неизменяемого массива
+    outFile << "\nTest 3: List and immutable views...";
+    MutableListSequence<std::string> words;
+    words.Append("alpha");
+    words.Append("beta");
+    words.Append("gamma");
+    words.Append("delta");
+    SequenceView<std::string> middle = words.GetSubsequenceView(1, 2);
+    assert(middle.Data() == nullptr);
+    assert(middle.ToString() == "[beta, gamma]");
+    std::string joined;
+    for (std::string word : middle) {
+        joined += word;
+    }
+    assert(joined == "betagamma");
+
+    int items[] = {5, 6, 7, 8, 9};
+    ImmutableArraySequence<int> frozen(items, 5);
+    SequenceView<int> tail = frozen.GetSubsequenceView(2, 4);
+    assert(tail.ToString() == "[7, 8, 9]" && tail.Data() == nullptr);
+
+    // View неизменяемого массива делит узлы вектора и переживает саму последовательность
+    ArraySequence<int>* big = new ImmutableArraySequence<int>();
+    for (int i = 0; i < 200; ++i) {
+        ArraySequence<int>* next = big->Append(i);
+        delete big;
+        big = next;
+    }
+    SequenceView<int> across = big->GetSubsequenceView(30, 129);
+    delete big;
+    assert(across.GetLength() == 100 && across.Get(0) == 30 && across.GetLast() == 129);
+    assert(std::accumulate(across.begin(), across.end(), 0) == (30 + 129) * 100 / 2);
+    SequenceView<int> narrow = across.Slice(1, 3);
+    assert(narrow.ToString() == "[31, 32, 33]");
+    MutableArraySequence<int>* narrowCopy = narrow.Materialize();
+    assert(narrowCopy->ToString() == "[31, 32, 33]");
+    delete narrowCopy;
+    outFile << " ✓" << std::endl;
+
+    // Тест 4: Materialize и изменяющие методы
+    outFile << "\nTest 4: Materialize and mutators...";
+    MutableArraySequence<int>* owned = window.Materialize();
+    assert(owned->GetLength() == 10 && owned->Get(0) == 10);
+    owned->Append(100);
+    assert(window.GetLength() == 10);
+    delete owned;
+
+    Sequence<int>* appended = tail.Append(10);
+    Sequence<int>* concatenated = tail.Concat(&tail);
+    assert(appended->ToString() == "[7, 8, 9, 10]");
+    assert(concatenated->ToString() == "[7, 8, 9, 7, 8, 9]");
+    assert(tail.GetLength() == 3);
+    delete appended;
+    delete concatenated;
+
+    Sequence<std::string>* listCopy = middle.Prepend("start");
+    assert(listCopy->ToString() == "[start, beta, gamma]");
+    delete listCopy;
+    outFile << " ✓" << std::endl;
+
+    // Тест 5: исключения
+    outFile << "\nTest 5: Exceptions...";
+    bool thrown = false;
+    try {
+        numbers.GetSubsequenceView(50, 200);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    thrown = false;
+    try {
+        window.Get(10);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    outFile << " ✓" << std::endl;
+
+    outFile << "\n=== All SequenceView tests passed successfully! ===" << std::endl;
+
+    outFile.close();
+    std::cout << "Тесты завершены. Результаты записаны в outputView.txt" << std::endl;
+}
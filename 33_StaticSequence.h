@@ -0,0 +1,310 @@
+#ifndef STATIC_SEQUENCE_H
+#define STATIC_SEQUENCE_H
+
+#include <stdexcept>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <iterator>
+#include "0_Sequence.h"
+#include "1_ArraySequence.h"
+
+// Последовательности без виртуальных вызовов (CRTP). Derived даёт Get, GetLength, begin/end,
+// GetResource, Reserve и Append, возвращающий Derived&. Общие алгоритмы живут здесь и зовут
+// методы Derived напрямую, поэтому компилятор их встраивает.
+// Где нужен полиморфизм во время выполнения, статическую последовательность оборачивает SequenceAdapter.
+template <class Derived, class T> class StaticSequence
+    {
+        public:
+            typedef T ValueType;
+
+            T GetFirst() const;
+            T GetLast() const;
+            bool IsEmpty() const;
+
+            // Как Stack::Reduce: result = f(item, result) от первого элемента к последнему
+            template <class F> T Reduce(F f, T initial) const;
+            template <class F> Derived Map(F f) const;
+            template <class F> Derived Where(F f) const;
+            int IndexOf(const T& item) const;
+            bool ContainsSubsequence(const T* items, int count) const;
+            std::string ToString() const;
+
+        protected:
+            const Derived& Self() const { return static_cast<const Derived&>(*this); }
+    };
+
+// Массив со статическим интерфейсом поверх MutableArraySequence: хранение, проверки границ и вставки -
+// его собственные, здесь только возвращаемые типы, нужные StaticSequence. Массив - поле известного
+// типа, а не указатель на базу, поэтому вызовы к нему связываются статически.
+// Как Sequence<T> массив видно через SequenceAdapter
+template <class T> class StaticArraySequence : public StaticSequence<StaticArraySequence<T>, T>
+    {
+        public:
+            explicit StaticArraySequence(MemoryResource* resource = DefaultResource());
+            StaticArraySequence(T* items, int count, MemoryResource* resource = DefaultResource());
+            template <class InputIt, class = typename std::iterator_traits<InputIt>::iterator_category>
+            StaticArraySequence(InputIt first, InputIt last, MemoryResource* resource = DefaultResource());
+            explicit StaticArraySequence(const DynamicArray<T>& items);
+
+            T Get(int index) const;
+            int GetLength() const;
+            StaticArraySequence<T> GetSubsequence(int startIndex, int endIndex) const;
+            MemoryResource* GetResource() const;
+            void Reserve(int capacity);
+
+            StaticArraySequence& Append(T item);
+            StaticArraySequence& Prepend(T item);
+            StaticArraySequence& InsertAt(T item, int index);
+            template <class InputIt> StaticArraySequence& AppendRange(InputIt first, InputIt last);
+            template <class... Args> StaticArraySequence& EmplaceBack(Args&&... args);
+
+            const T* begin() const;
+            const T* end() const;
+            const MutableArraySequence<T>& Array() const;
+
+        private:
+            MutableArraySequence<T> array;
+    };
+
+// Тонкий переходник к виртуальному Sequence<T>: каждый метод - один вызов статической версии.
+// Изменяющие методы, как у MutableArraySequence, меняют объект и возвращают this
+template <class S> class SequenceAdapter : public Sequence<typename S::ValueType>
+    {
+        public:
+            typedef typename S::ValueType T;
+
+            SequenceAdapter();
+            explicit SequenceAdapter(S sequence);
+
+            T GetFirst() const override;
+            T GetLast() const override;
+            T Get(int index) const override;
+            int GetLength() const override;
+            SequenceAdapter<S>* GetSubsequence(int startIndex, int endIndex) const override;
+
+            SequenceAdapter<S>* Append(T item) override;
+            SequenceAdapter<S>* Prepend(T item) override;
+            SequenceAdapter<S>* InsertAt(T item, int index) override;
+            SequenceAdapter<S>* Concat(Sequence<T>* other) override;
+            std::string ToString() const override;
+
+            S& Static();
+            const S& Static() const;
+
+        private:
+            S sequence;
+    };
+
+////////////////////////////////////////////////////////////////////////////
+
+template <class Derived, class T> T StaticSequence<Derived, T>::GetFirst() const {
+    if (IsEmpty()) throw std::out_of_range("Sequence is empty");
+    return Self().Get(0);
+}
+
+template <class Derived, class T> T StaticSequence<Derived, T>::GetLast() const {
+    if (IsEmpty()) throw std::out_of_range("Sequence is empty");
+    return Self().Get(Self().GetLength() - 1);
+}
+
+template <class Derived, class T> bool StaticSequence<Derived, T>::IsEmpty() const {
+    return Self().GetLength() == 0;
+}
+
+template <class Derived, class T> template <class F> T StaticSequence<Derived, T>::Reduce(F f, T initial) const {
+    for (const T& item : Self()) {
+        initial = f(item, std::move(initial));
+    }
+    return initial;
+}
+
+template <class Derived, class T> template <class F> Derived StaticSequence<Derived, T>::Map(F f) const {
+    Derived result(Self().GetResource());
+    result.Reserve(Self().GetLength());
+    for (const T& item : Self()) {
+        result.Append(f(item));
+    }
+    return result;
+}
+
+template <class Derived, class T> template <class F> Derived StaticSequence<Derived, T>::Where(F f) const {
+    Derived result(Self().GetResource());
+    for (const T& item : Self()) {
+        if (f(item)) result.Append(item);
+    }
+    return result;
+}
+
+template <class Derived, class T> int StaticSequence<Derived, T>::IndexOf(const T& item) const {
+    int index = 0;
+    for (const T& current : Self()) {
+        if (current == item) return index;
+        ++index;
+    }
+    return -1;
+}
+
+template <class Derived, class T> bool StaticSequence<Derived, T>::ContainsSubsequence(const T* items, int count) const {
+    if (count < 0) throw std::invalid_argument("Invalid size");
+    int length = Self().GetLength();
+    for (int i = 0; i + count <= length; ++i) {
+        int j = 0;
+        while (j < count && Self().Get(i + j) == items[j]) {
+            ++j;
+        }
+        if (j == count) return true;
+    }
+    return false;
+}
+
+template <class Derived, class T> std::string StaticSequence<Derived, T>::ToString() const {
+    std::ostringstream oss;
+    oss << "[";
+    bool first = true;
+    for (const T& item : Self()) {
+        if (!first) oss << ", ";
+        oss << item;
+        first = false;
+    }
+    oss << "]";
+    return oss.str();
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+template <class T> StaticArraySequence<T>::StaticArraySequence(MemoryResource* resource)
+    : array(resource) {}
+
+template <class T> StaticArraySequence<T>::StaticArraySequence(T* items, int count, MemoryResource* resource)
+    : array(items, items + count, resource) {}
+
+template <class T> template <class InputIt, class>
+StaticArraySequence<T>::StaticArraySequence(InputIt first, InputIt last, MemoryResource* resource)
+    : array(first, last, resource) {}
+
+template <class T> StaticArraySequence<T>::StaticArraySequence(const DynamicArray<T>& items)
+    : array(items) {}
+
+template <class T> T StaticArraySequence<T>::Get(int index) const {
+    return array.Get(index);
+}
+
+template <class T> int StaticArraySequence<T>::GetLength() const {
+    return array.GetLength();
+}
+
+// Элементы среза копируются из общего буфера напрямую, без промежуточной последовательности в куче
+template <class T> StaticArraySequence<T> StaticArraySequence<T>::GetSubsequence(int startIndex, int endIndex) const {
+    SequenceView<T> view = array.GetSubsequenceView(startIndex, endIndex);
+    return StaticArraySequence<T>(view.Data(), view.Data() + view.GetLength(), GetResource());
+}
+
+template <class T> MemoryResource* StaticArraySequence<T>::GetResource() const {
+    return array.GetResource();
+}
+
+template <class T> void StaticArraySequence<T>::Reserve(int capacity) {
+    array.Reserve(capacity);
+}
+
+template <class T> StaticArraySequence<T>& StaticArraySequence<T>::Append(T item) {
+    array.Append(std::move(item));
+    return *this;
+}
+
+template <class T> StaticArraySequence<T>& StaticArraySequence<T>::Prepend(T item) {
+    array.Prepend(std::move(item));
+    return *this;
+}
+
+template <class T> StaticArraySequence<T>& StaticArraySequence<T>::InsertAt(T item, int index) {
+    array.InsertAt(std::move(item), index);
+    return *this;
+}
+
+template <class T> template <class InputIt> StaticArraySequence<T>& StaticArraySequence<T>::AppendRange(InputIt first, InputIt last) {
+    array.AppendRange(first, last);
+    return *this;
+}
+
+template <class T> template <class... Args> StaticArraySequence<T>& StaticArraySequence<T>::EmplaceBack(Args&&... args) {
+    array.EmplaceBack(std::forward<Args>(args)...);
+    return *this;
+}
+
+template <class T> const T* StaticArraySequence<T>::begin() const {
+    return array.begin();
+}
+
+template <class T> const T* StaticArraySequence<T>::end() const {
+    return array.end();
+}
+
+template <class T> const MutableArraySequence<T>& StaticArraySequence<T>::Array() const {
+    return array;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+template <class S> SequenceAdapter<S>::SequenceAdapter() : sequence() {}
+
+template <class S> SequenceAdapter<S>::SequenceAdapter(S sequence) : sequence(std::move(sequence)) {}
+
+template <class S> typename SequenceAdapter<S>::T SequenceAdapter<S>::GetFirst() const {
+    return sequence.GetFirst();
+}
+
+template <class S> typename SequenceAdapter<S>::T SequenceAdapter<S>::GetLast() const {
+    return sequence.GetLast();
+}
+
+template <class S> typename SequenceAdapter<S>::T SequenceAdapter<S>::Get(int index) const {
+    return sequence.Get(index);
+}
+
+template <class S> int SequenceAdapter<S>::GetLength() const {
+    return sequence.GetLength();
+}
+
+template <class S> SequenceAdapter<S>* SequenceAdapter<S>::GetSubsequence(int startIndex, int endIndex) const {
+    return new SequenceAdapter<S>(sequence.GetSubsequence(startIndex, endIndex));
+}
+
+template <class S> SequenceAdapter<S>* SequenceAdapter<S>::Append(T item) {
+    sequence.Append(std::move(item));
+    return this;
+}
+
+template <class S> SequenceAdapter<S>* SequenceAdapter<S>::Prepend(T item) {
+    sequence.Prepend(std::move(item));
+    return this;
+}
+
+template <class S> SequenceAdapter<S>* SequenceAdapter<S>::InsertAt(T item, int index) {
+    sequence.InsertAt(std::move(item), index);
+    return this;
+}
+
+template <class S> SequenceAdapter<S>* SequenceAdapter<S>::Concat(Sequence<T>* other) {
+    if (!other) throw std::invalid_argument("Other sequence cannot be null");
+
+    S result(sequence);
+    result.Reserve(sequence.GetLength() + other->GetLength());
+    result.AppendRange(other->begin(), other->end());
+    return new SequenceAdapter<S>(std::move(result));
+}
+
+template <class S> std::string SequenceAdapter<S>::ToString() const {
+    return sequence.ToString();
+}
+
+template <class S> S& SequenceAdapter<S>::Static() {
+    return sequence;
+}
+
+template <class S> const S& SequenceAdapter<S>::Static() const {
+    return sequence;
+}
+
+#endif
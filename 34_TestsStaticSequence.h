@@ -0,0 +1,90 @@
+#include "1_ArraySequence.h"
+#include "33_StaticSequence.h"
+#include <iostream>
+#include <fstream>
+#include <cassert>
+#include <string>
+
+void testStaticSequence() {
+    std::ofstream outFile("outputStatic.txt");
+    if (!outFile) {
+        std::cerr << "Не удалось открыть файл outputStatic.txt для записи" << std::endl;
+        return;
+    }
+
+    outFile << "=== Starting StaticSequence tests ===" << std::endl;
+
+    // Тест 1: базовые операции без виртуальных вызовов
+    outFile << "\nTest 1: StaticArraySequence basics...";
+    int items[] = {3, 1, 4, 1, 5};
+    StaticArraySequence<int> numbers(items, 5);
+    numbers.Append(9).Prepend(2).InsertAt(6, 3);
+    assert(numbers.ToString() == "[2, 3, 1, 6, 4, 1, 5, 9]");
+    assert(numbers.GetFirst() == 2 && numbers.GetLast() == 9 && numbers.GetLength() == 8);
+    StaticArraySequence<int> middle = numbers.GetSubsequence(2, 4);
+    assert(middle.ToString() == "[1, 6, 4]");
+    outFile << " " << numbers.ToString() << " ✓" << std::endl;
+
+    // Тест 2: общие алгоритмы
+    outFile << "\nTest 2: Shared algorithms...";
+    assert(numbers.Reduce([](int x, int sum) { return x + sum; }, 0) == 31);
+    StaticArraySequence<int> squares = numbers.Map([](int x) { return x * x; });
+    assert(squares.Get(3) == 36 && squares.GetLength() == 8);
+    StaticArraySequence<int> odd = numbers.Where([](int x) { return x % 2 != 0; });
+    assert(odd.ToString() == "[3, 1, 1, 5, 9]");
+    assert(numbers.IndexOf(4) == 4 && numbers.IndexOf(7) == -1);
+    int pattern[] = {1, 5, 9};
+    int missing[] = {5, 1};
+    assert(numbers.ContainsSubsequence(pattern, 3) && !numbers.ContainsSubsequence(missing, 2));
+
+    StaticArraySequence<std::string> words;
+    words.EmplaceBack(3, 'a').Append("b");
+    assert(words.Reduce([](const std::string& word, std::string all) { return all + word; }, "") == "aaab");
+    outFile << " ✓" << std::endl;
+
+    // Тест 3: переходник к Sequence<T>
+    outFile << "\nTest 3: SequenceAdapter...";
+    SequenceAdapter<StaticArraySequence<int>> adapter(numbers);
+    Sequence<int>* erased = &adapter;
+    assert(erased->Get(3) == 6 && erased->GetLength() == 8);
+    erased->Append(7);
+    assert(adapter.Static().GetLast() == 7 && numbers.GetLength() == 8);
+
+    MutableArraySequence<int> tail(items, 2);
+    Sequence<int>* joined = erased->Concat(&tail);
+    assert(joined->GetLength() == 11 && joined->GetLast() == 1);
+    Sequence<int>* sub = joined->GetSubsequence(8, 10);
+    assert(sub->ToString() == "[7, 3, 1]");
+    int sum = 0;
+    for (int item : *sub) {
+        sum += item;
+    }
+    assert(sum == 11);
+    delete sub;
+    delete joined;
+    outFile << " ✓" << std::endl;
+
+    // Тест 4: исключения
+    outFile << "\nTest 4: Exceptions...";
+    bool thrown = false;
+    try {
+        StaticArraySequence<int> empty;
+        empty.GetLast();
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    thrown = false;
+    try {
+        erased->GetSubsequence(5, 20);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    outFile << " ✓" << std::endl;
+
+    outFile << "\n=== All StaticSequence tests passed successfully! ===" << std::endl;
+
+    outFile.close();
+    std::cout << "Тесты завершены. Результаты записаны в outputStatic.txt" << std::endl;
+}
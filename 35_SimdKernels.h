@@ -0,0 +1,360 @@
+#ifndef SIMD_KERNELS_H
+#define SIMD_KERNELS_H
+
+// Поэлементные ядра над смежными массивами из n элементов:
+//   Add:   out[i] = a[i] + b[i]
+//   Sub:   out[i] = a[i] - b[i]
+//   Scale: out[i] = a[i] * s
+//   Axpy:  out[i] += a[i] * s
+//   Dot:   сумма a[i] * b[i]
+//   Horner: out[i] = c[0] + c[1] * x[i] + ... + c[length - 1] * x[i]^(length - 1), length >= 1
+// out может совпадать с a или b. Векторный Dot складывает в другом порядке, чем скалярный,
+// поэтому для float и double результат может отличаться в последних разрядах. Для float, double и int на x86 есть версии на SSE2 и AVX2.
+// AVX2 выбирается во время выполнения, поэтому программа собирается без -mavx2 и
+// работает на любом x86-64. Для остальных T и других платформ - скалярный цикл.
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+#define SIMD_KERNELS_X86
+#include <immintrin.h>
+#endif
+
+template <class T> struct ScalarKernels
+    {
+        static void Add(const T* a, const T* b, T* out, int n) {
+            for (int i = 0; i < n; ++i) out[i] = a[i] + b[i];
+        }
+
+        static void Sub(const T* a, const T* b, T* out, int n) {
+            for (int i = 0; i < n; ++i) out[i] = a[i] - b[i];
+        }
+
+        static void Scale(const T* a, const T& s, T* out, int n) {
+            for (int i = 0; i < n; ++i) out[i] = a[i] * s;
+        }
+
+        static void Axpy(const T* a, const T& s, T* out, int n) {
+            for (int i = 0; i < n; ++i) out[i] += a[i] * s;
+        }
+
+        static T Dot(const T* a, const T* b, int n) {
+            T sum = T(0);
+            for (int i = 0; i < n; ++i) sum += a[i] * b[i];
+            return sum;
+        }
+
+        static void Horner(const T* c, int length, const T* x, T* out, int n) {
+            for (int i = 0; i < n; ++i) {
+                T acc = c[length - 1];
+                for (int k = length - 2; k >= 0; --k) acc = acc * x[i] + c[k];
+                out[i] = acc;
+            }
+        }
+    };
+
+// Общий вход: для типов без векторной версии - скалярный цикл
+template <class T> struct SimdKernels : ScalarKernels<T> {};
+
+#ifdef SIMD_KERNELS_X86
+
+inline bool CpuHasAvx2() {
+    static const bool avx2 = (__builtin_cpu_init(), __builtin_cpu_supports("avx2") != 0);
+    return avx2;
+}
+
+// Операции одного набора инструкций: T - элемент, Vec - регистр на WIDTH элементов
+struct Sse2Float
+    {
+        typedef float T;
+        typedef __m128 Vec;
+        enum { WIDTH = 4 };
+        static Vec Load(const T* p) { return _mm_loadu_ps(p); }
+        static void Store(T* p, Vec v) { _mm_storeu_ps(p, v); }
+        static Vec Broadcast(T s) { return _mm_set1_ps(s); }
+        static Vec Add(Vec x, Vec y) { return _mm_add_ps(x, y); }
+        static Vec Sub(Vec x, Vec y) { return _mm_sub_ps(x, y); }
+        static Vec Mul(Vec x, Vec y) { return _mm_mul_ps(x, y); }
+    };
+
+struct Sse2Double
+    {
+        typedef double T;
+        typedef __m128d Vec;
+        enum { WIDTH = 2 };
+        static Vec Load(const T* p) { return _mm_loadu_pd(p); }
+        static void Store(T* p, Vec v) { _mm_storeu_pd(p, v); }
+        static Vec Broadcast(T s) { return _mm_set1_pd(s); }
+        static Vec Add(Vec x, Vec y) { return _mm_add_pd(x, y); }
+        static Vec Sub(Vec x, Vec y) { return _mm_sub_pd(x, y); }
+        static Vec Mul(Vec x, Vec y) { return _mm_mul_pd(x, y); }
+    };
+
+// Умножения 32-битных целых в SSE2 нет: Scale, Axpy, Dot и Horner для int на SSE2 идут скалярным циклом
+struct Sse2Int
+    {
+        typedef int T;
+        typedef __m128i Vec;
+        enum { WIDTH = 4 };
+        static Vec Load(const T* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+        static void Store(T* p, Vec v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+        static Vec Add(Vec x, Vec y) { return _mm_add_epi32(x, y); }
+        static Vec Sub(Vec x, Vec y) { return _mm_sub_epi32(x, y); }
+    };
+
+template <class Ops> struct Sse2Loops
+    {
+        typedef typename Ops::T T;
+
+        static void Add(const T* a, const T* b, T* out, int n) {
+            int i = 0;
+            for (; i + Ops::WIDTH <= n; i += Ops::WIDTH) {
+                Ops::Store(out + i, Ops::Add(Ops::Load(a + i), Ops::Load(b + i)));
+            }
+            ScalarKernels<T>::Add(a + i, b + i, out + i, n - i);
+        }
+
+        static void Sub(const T* a, const T* b, T* out, int n) {
+            int i = 0;
+            for (; i + Ops::WIDTH <= n; i += Ops::WIDTH) {
+                Ops::Store(out + i, Ops::Sub(Ops::Load(a + i), Ops::Load(b + i)));
+            }
+            ScalarKernels<T>::Sub(a + i, b + i, out + i, n - i);
+        }
+
+        static void Scale(const T* a, const T& s, T* out, int n) {
+            typename Ops::Vec factor = Ops::Broadcast(s);
+            int i = 0;
+            for (; i + Ops::WIDTH <= n; i += Ops::WIDTH) {
+                Ops::Store(out + i, Ops::Mul(Ops::Load(a + i), factor));
+            }
+            ScalarKernels<T>::Scale(a + i, s, out + i, n - i);
+        }
+
+        static void Axpy(const T* a, const T& s, T* out, int n) {
+            typename Ops::Vec factor = Ops::Broadcast(s);
+            int i = 0;
+            for (; i + Ops::WIDTH <= n; i += Ops::WIDTH) {
+                Ops::Store(out + i, Ops::Add(Ops::Load(out + i), Ops::Mul(Ops::Load(a + i), factor)));
+            }
+            ScalarKernels<T>::Axpy(a + i, s, out + i, n - i);
+        }
+
+        static T Dot(const T* a, const T* b, int n) {
+            typename Ops::Vec acc = Ops::Broadcast(T(0));
+            int i = 0;
+            for (; i + Ops::WIDTH <= n; i += Ops::WIDTH) {
+                acc = Ops::Add(acc, Ops::Mul(Ops::Load(a + i), Ops::Load(b + i)));
+            }
+            T lanes[Ops::WIDTH];
+            Ops::Store(lanes, acc);
+            T sum = ScalarKernels<T>::Dot(a + i, b + i, n - i);
+            for (int lane = 0; lane < Ops::WIDTH; ++lane) sum += lanes[lane];
+            return sum;
+        }
+
+        // Два регистра точек за проход: цепочки умножений независимы и идут параллельно
+        static void Horner(const T* c, int length, const T* x, T* out, int n) {
+            int i = 0;
+            for (; i + 2 * Ops::WIDTH <= n; i += 2 * Ops::WIDTH) {
+                typename Ops::Vec x0 = Ops::Load(x + i);
+                typename Ops::Vec x1 = Ops::Load(x + i + Ops::WIDTH);
+                typename Ops::Vec acc0 = Ops::Broadcast(c[length - 1]);
+                typename Ops::Vec acc1 = acc0;
+                for (int k = length - 2; k >= 0; --k) {
+                    typename Ops::Vec coefficient = Ops::Broadcast(c[k]);
+                    acc0 = Ops::Add(Ops::Mul(acc0, x0), coefficient);
+                    acc1 = Ops::Add(Ops::Mul(acc1, x1), coefficient);
+                }
+                Ops::Store(out + i, acc0);
+                Ops::Store(out + i + Ops::WIDTH, acc1);
+            }
+            ScalarKernels<T>::Horner(c, length, x + i, out + i, n - i);
+        }
+    };
+
+// Всё до pop_options собирается с AVX2 и вызывается только после проверки CpuHasAvx2()
+#pragma GCC push_options
+#pragma GCC target("avx2")
+
+struct Avx2Float
+    {
+        typedef float T;
+        typedef __m256 Vec;
+        enum { WIDTH = 8 };
+        static Vec Load(const T* p) { return _mm256_loadu_ps(p); }
+        static void Store(T* p, Vec v) { _mm256_storeu_ps(p, v); }
+        static Vec Broadcast(T s) { return _mm256_set1_ps(s); }
+        static Vec Add(Vec x, Vec y) { return _mm256_add_ps(x, y); }
+        static Vec Sub(Vec x, Vec y) { return _mm256_sub_ps(x, y); }
+        static Vec Mul(Vec x, Vec y) { return _mm256_mul_ps(x, y); }
+    };
+
+struct Avx2Double
+    {
+        typedef double T;
+        typedef __m256d Vec;
+        enum { WIDTH = 4 };
+        static Vec Load(const T* p) { return _mm256_loadu_pd(p); }
+        static void Store(T* p, Vec v) { _mm256_storeu_pd(p, v); }
+        static Vec Broadcast(T s) { return _mm256_set1_pd(s); }
+        static Vec Add(Vec x, Vec y) { return _mm256_add_pd(x, y); }
+        static Vec Sub(Vec x, Vec y) { return _mm256_sub_pd(x, y); }
+        static Vec Mul(Vec x, Vec y) { return _mm256_mul_pd(x, y); }
+    };
+
+struct Avx2Int
+    {
+        typedef int T;
+        typedef __m256i Vec;
+        enum { WIDTH = 8 };
+        static Vec Load(const T* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+        static void Store(T* p, Vec v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+        static Vec Broadcast(T s) { return _mm256_set1_epi32(s); }
+        static Vec Add(Vec x, Vec y) { return _mm256_add_epi32(x, y); }
+        static Vec Sub(Vec x, Vec y) { return _mm256_sub_epi32(x, y); }
+        static Vec Mul(Vec x, Vec y) { return _mm256_mullo_epi32(x, y); }
+    };
+
+// Те же циклы, что в Sse2Loops, но собранные с AVX2: шаблон наследует набор
+// инструкций от места определения, поэтому общий шаблон здесь не подходит
+template <class Ops> struct Avx2Loops
+    {
+        typedef typename Ops::T T;
+
+        static void Add(const T* a, const T* b, T* out, int n) {
+            int i = 0;
+            for (; i + Ops::WIDTH <= n; i += Ops::WIDTH) {
+                Ops::Store(out + i, Ops::Add(Ops::Load(a + i), Ops::Load(b + i)));
+            }
+            for (; i < n; ++i) out[i] = a[i] + b[i];
+        }
+
+        static void Sub(const T* a, const T* b, T* out, int n) {
+            int i = 0;
+            for (; i + Ops::WIDTH <= n; i += Ops::WIDTH) {
+                Ops::Store(out + i, Ops::Sub(Ops::Load(a + i), Ops::Load(b + i)));
+            }
+            for (; i < n; ++i) out[i] = a[i] - b[i];
+        }
+
+        static void Scale(const T* a, const T& s, T* out, int n) {
+            typename Ops::Vec factor = Ops::Broadcast(s);
+            int i = 0;
+            for (; i + Ops::WIDTH <= n; i += Ops::WIDTH) {
+                Ops::Store(out + i, Ops::Mul(Ops::Load(a + i), factor));
+            }
+            for (; i < n; ++i) out[i] = a[i] * s;
+        }
+
+        static void Axpy(const T* a, const T& s, T* out, int n) {
+            typename Ops::Vec factor = Ops::Broadcast(s);
+            int i = 0;
+            for (; i + Ops::WIDTH <= n; i += Ops::WIDTH) {
+                Ops::Store(out + i, Ops::Add(Ops::Load(out + i), Ops::Mul(Ops::Load(a + i), factor)));
+            }
+            for (; i < n; ++i) out[i] += a[i] * s;
+        }
+
+        static T Dot(const T* a, const T* b, int n) {
+            typename Ops::Vec acc = Ops::Broadcast(T(0));
+            int i = 0;
+            for (; i + Ops::WIDTH <= n; i += Ops::WIDTH) {
+                acc = Ops::Add(acc, Ops::Mul(Ops::Load(a + i), Ops::Load(b + i)));
+            }
+            T lanes[Ops::WIDTH];
+            Ops::Store(lanes, acc);
+            T sum = T(0);
+            for (; i < n; ++i) sum += a[i] * b[i];
+            for (int lane = 0; lane < Ops::WIDTH; ++lane) sum += lanes[lane];
+            return sum;
+        }
+
+        static void Horner(const T* c, int length, const T* x, T* out, int n) {
+            int i = 0;
+            for (; i + 2 * Ops::WIDTH <= n; i += 2 * Ops::WIDTH) {
+                typename Ops::Vec x0 = Ops::Load(x + i);
+                typename Ops::Vec x1 = Ops::Load(x + i + Ops::WIDTH);
+                typename Ops::Vec acc0 = Ops::Broadcast(c[length - 1]);
+                typename Ops::Vec acc1 = acc0;
+                for (int k = length - 2; k >= 0; --k) {
+                    typename Ops::Vec coefficient = Ops::Broadcast(c[k]);
+                    acc0 = Ops::Add(Ops::Mul(acc0, x0), coefficient);
+                    acc1 = Ops::Add(Ops::Mul(acc1, x1), coefficient);
+                }
+                Ops::Store(out + i, acc0);
+                Ops::Store(out + i + Ops::WIDTH, acc1);
+            }
+            for (; i < n; ++i) {
+                T acc = c[length - 1];
+                for (int k = length - 2; k >= 0; --k) acc = acc * x[i] + c[k];
+                out[i] = acc;
+            }
+        }
+    };
+
+#pragma GCC pop_options
+
+// Выбор версии на каждом вызове: проверка - одно чтение статической переменной
+template <class Sse2, class Avx2> struct DispatchedKernels
+    {
+        typedef typename Sse2::T T;
+
+        static void Add(const T* a, const T* b, T* out, int n) {
+            if (CpuHasAvx2()) Avx2Loops<Avx2>::Add(a, b, out, n);
+            else Sse2Loops<Sse2>::Add(a, b, out, n);
+        }
+
+        static void Sub(const T* a, const T* b, T* out, int n) {
+            if (CpuHasAvx2()) Avx2Loops<Avx2>::Sub(a, b, out, n);
+            else Sse2Loops<Sse2>::Sub(a, b, out, n);
+        }
+
+        static void Scale(const T* a, const T& s, T* out, int n) {
+            if (CpuHasAvx2()) Avx2Loops<Avx2>::Scale(a, s, out, n);
+            else Sse2Loops<Sse2>::Scale(a, s, out, n);
+        }
+
+        static void Axpy(const T* a, const T& s, T* out, int n) {
+            if (CpuHasAvx2()) Avx2Loops<Avx2>::Axpy(a, s, out, n);
+            else Sse2Loops<Sse2>::Axpy(a, s, out, n);
+        }
+
+        static T Dot(const T* a, const T* b, int n) {
+            if (CpuHasAvx2()) return Avx2Loops<Avx2>::Dot(a, b, n);
+            return Sse2Loops<Sse2>::Dot(a, b, n);
+        }
+
+        static void Horner(const T* c, int length, const T* x, T* out, int n) {
+            if (CpuHasAvx2()) Avx2Loops<Avx2>::Horner(c, length, x, out, n);
+            else Sse2Loops<Sse2>::Horner(c, length, x, out, n);
+        }
+    };
+
+template <> struct SimdKernels<float> : DispatchedKernels<Sse2Float, Avx2Float> {};
+template <> struct SimdKernels<double> : DispatchedKernels<Sse2Double, Avx2Double> {};
+
+template <> struct SimdKernels<int> : DispatchedKernels<Sse2Int, Avx2Int>
+    {
+        static void Scale(const int* a, const int& s, int* out, int n) {
+            if (CpuHasAvx2()) Avx2Loops<Avx2Int>::Scale(a, s, out, n);
+            else ScalarKernels<int>::Scale(a, s, out, n);
+        }
+
+        static void Axpy(const int* a, const int& s, int* out, int n) {
+            if (CpuHasAvx2()) Avx2Loops<Avx2Int>::Axpy(a, s, out, n);
+            else ScalarKernels<int>::Axpy(a, s, out, n);
+        }
+
+        static int Dot(const int* a, const int* b, int n) {
+            if (CpuHasAvx2()) return Avx2Loops<Avx2Int>::Dot(a, b, n);
+            return ScalarKernels<int>::Dot(a, b, n);
+        }
+
+        static void Horner(const int* c, int length, const int* x, int* out, int n) {
+            if (CpuHasAvx2()) Avx2Loops<Avx2Int>::Horner(c, length, x, out, n);
+            else ScalarKernels<int>::Horner(c, length, x, out, n);
+        }
+    };
+
+#endif
+
+#endif
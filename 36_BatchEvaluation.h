@@ -0,0 +1,147 @@
+#ifndef BATCH_EVALUATION_H
+#define BATCH_EVALUATION_H
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+#include "3_DynamicArray.h"
+#include "35_SimdKernels.h"
+
+// Значения набора аффинных форм bias + <weights, x> сразу на многих точках (GEMV/GEMM).
+// Точки - матрица count x dim:
+//   ROW_MAJOR:    координата j точки p лежит в points[p * dim + j]
+//   COLUMN_MAJOR: координата j точки p лежит в points[j * count + p]
+// Результат - матрица count x formCount по строкам: out[p * formCount + f]
+
+enum MatrixLayout { ROW_MAJOR, COLUMN_MAJOR };
+
+template <class T> struct BatchForm
+    {
+        T bias;
+        const T* weights;
+    };
+
+template <class T> class BatchEvaluator
+    {
+        public:
+            // Блоки подобраны под кэши: плитка точек ROW_POINTS x DIM_BLOCK - в L2,
+            // отрезок весов на DIM_BLOCK - в L1. В COLUMN_MAJOR аккумуляторы блока
+            // из COLUMN_POINTS точек остаются в L1, пока к ним прибавляются все столбцы
+            static const int ROW_POINTS = 64;
+            static const int DIM_BLOCK = 256;
+            static const int COLUMN_POINTS = 1024;
+            // Меньше точек на поток не выгодно: запуск потока дороже их вычисления
+            static const int MIN_POINTS_PER_THREAD = 4096;
+
+            // threads - сколько потоков использовать, 0 - по числу ядер.
+            // Точки делятся на непрерывные части, каждый поток пишет только свои строки out
+            static void Evaluate(const BatchForm<T>* forms, int formCount, int dim,
+                                 const T* points, int count, MatrixLayout layout, T* out, int threads = 1) {
+                if (threads <= 0) {
+                    threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+                }
+                threads = std::max(1, std::min(threads, count / MIN_POINTS_PER_THREAD));
+
+                // Буферы потоков выделяются здесь: исключение внутри потока завершило бы программу
+                int scratchLength = (layout == COLUMN_MAJOR && formCount > 1) ? COLUMN_POINTS : 0;
+                DynamicArray<T> scratch(scratchLength * threads);
+
+                Task task = { forms, formCount, dim, points, count, layout, out };
+                if (threads == 1) {
+                    task.Run(0, count, scratch.Data());
+                    return;
+                }
+
+                std::vector<std::thread> workers;
+                workers.reserve(threads - 1);
+                int chunk = (count + threads - 1) / threads;
+                try {
+                    for (int t = 1; t < threads; ++t) {
+                        int begin = std::min(count, t * chunk);
+                        int end = std::min(count, begin + chunk);
+                        T* buffer = scratch.Data() + scratchLength * t;
+                        workers.emplace_back([&task, begin, end, buffer]() { task.Run(begin, end, buffer); });
+                    }
+                } catch (...) {
+                    // Поток не запустился: уже запущенные дожидаемся, иначе их деструктор вызовет std::terminate
+                    for (std::thread& worker : workers) {
+                        worker.join();
+                    }
+                    throw;
+                }
+                task.Run(0, std::min(count, chunk), scratch.Data());
+                for (std::thread& worker : workers) {
+                    worker.join();
+                }
+            }
+
+        private:
+            struct Task
+                {
+                    const BatchForm<T>* forms;
+                    int formCount;
+                    int dim;
+                    const T* points;
+                    int count;
+                    MatrixLayout layout;
+                    T* out;
+
+                    void Run(int begin, int end, T* scratch) const {
+                        if (layout == ROW_MAJOR) RunRows(begin, end);
+                        else RunColumns(begin, end, scratch);
+                    }
+
+                    // Каждая точка - скалярное произведение со строкой; плитка точек
+                    // проходит по всем формам, пока лежит в кэше
+                    void RunRows(int begin, int end) const {
+                        for (int blockBegin = begin; blockBegin < end; blockBegin += ROW_POINTS) {
+                            int blockEnd = std::min(end, blockBegin + ROW_POINTS);
+                            for (int p = blockBegin; p < blockEnd; ++p) {
+                                for (int f = 0; f < formCount; ++f) {
+                                    out[static_cast<std::size_t>(p) * formCount + f] = forms[f].bias;
+                                }
+                            }
+                            for (int j = 0; j < dim; j += DIM_BLOCK) {
+                                int length = std::min(DIM_BLOCK, dim - j);
+                                for (int f = 0; f < formCount; ++f) {
+                                    const T* weights = forms[f].weights + j;
+                                    for (int p = blockBegin; p < blockEnd; ++p) {
+                                        const T* row = points + static_cast<std::size_t>(p) * dim + j;
+                                        out[static_cast<std::size_t>(p) * formCount + f] +=
+                                            SimdKernels<T>::Dot(weights, row, length);
+                                    }
+                                }
+                            }
+                        }
+                    }
+
+                    // Столбец координаты j умножается на вес и прибавляется к значениям блока точек.
+                    // Для одной формы значения копятся прямо в out, для нескольких - в scratch
+                    void RunColumns(int begin, int end, T* scratch) const {
+                        for (int blockBegin = begin; blockBegin < end; blockBegin += COLUMN_POINTS) {
+                            int length = std::min(COLUMN_POINTS, end - blockBegin);
+                            for (int f = 0; f < formCount; ++f) {
+                                T* values = formCount == 1 ? out + blockBegin : scratch;
+                                std::fill(values, values + length, forms[f].bias);
+                                for (int j = 0; j < dim; ++j) {
+                                    const T* column = points + static_cast<std::size_t>(j) * count + blockBegin;
+                                    SimdKernels<T>::Axpy(column, forms[f].weights[j], values, length);
+                                }
+                                if (formCount > 1) {
+                                    for (int p = 0; p < length; ++p) {
+                                        out[static_cast<std::size_t>(blockBegin + p) * formCount + f] = values[p];
+                                    }
+                                }
+                            }
+                        }
+                    }
+                };
+    };
+
+template <class T> const int BatchEvaluator<T>::ROW_POINTS;
+template <class T> const int BatchEvaluator<T>::DIM_BLOCK;
+template <class T> const int BatchEvaluator<T>::COLUMN_POINTS;
+template <class T> const int BatchEvaluator<T>::MIN_POINTS_PER_THREAD;
+
+#endif
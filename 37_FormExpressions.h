@@ -0,0 +1,117 @@
+#ifndef FORM_EXPRESSIONS_H
+#define FORM_EXPRESSIONS_H
+
+#include <stdexcept>
+
+// Ленивая арифметика линейных форм. a + b * 2 - c не считает ничего сразу, а строит
+// дерево выражения; форма, которой его присваивают, проходит по коэффициентам один раз
+// и выделяет один буфер под результат. Узлы хранят подвыражения по значению, а формы -
+// по указателю на коэффициенты: формы должны жить и не меняться, пока живёт выражение.
+// Длины сверяются при построении узла, деление на ноль ловится там же.
+
+template <class T, class E> struct FormExpression
+    {
+        typedef T Value;
+        const E& Self() const { return static_cast<const E&>(*this); }
+    };
+
+// Лист дерева: коэффициенты существующей формы
+template <class T> class FormTerm : public FormExpression<T, FormTerm<T>>
+    {
+        public:
+            FormTerm(const T* data, int length) : data(data), length(length) {}
+            int GetLength() const { return length; }
+            T Get(int index) const { return data[index]; }
+
+        private:
+            const T* data;
+            int length;
+    };
+
+// Как узел хранит операнд: подвыражения - как есть, LinearForm заменяется на FormTerm
+// (специализация в 5_Linearform.h)
+template <class E> struct FormOperand
+    {
+        typedef E Type;
+        static const E& Wrap(const E& expression) { return expression; }
+    };
+
+struct FormPlus
+    {
+        template <class T> static T Apply(const T& left, const T& right) { return left + right; }
+    };
+
+struct FormMinus
+    {
+        template <class T> static T Apply(const T& left, const T& right) { return left - right; }
+    };
+
+template <class T, class L, class R, class Op> class FormBinary : public FormExpression<T, FormBinary<T, L, R, Op>>
+    {
+        public:
+            FormBinary(const L& left, const R& right) : left(left), right(right) {
+                if (left.GetLength() != right.GetLength()) {
+                    throw std::invalid_argument("Linear forms have different dimensions");
+                }
+            }
+            int GetLength() const { return left.GetLength(); }
+            T Get(int index) const { return Op::Apply(left.Get(index), right.Get(index)); }
+
+        private:
+            L left;
+            R right;
+    };
+
+template <class T, class E> class FormScaled : public FormExpression<T, FormScaled<T, E>>
+    {
+        public:
+            FormScaled(const E& inner, const T& factor) : inner(inner), factor(factor) {}
+            int GetLength() const { return inner.GetLength(); }
+            T Get(int index) const { return inner.Get(index) * factor; }
+
+        private:
+            E inner;
+            T factor;
+    };
+
+//////////////////////////////////////////////////////////////////////
+// Операторы. Скаляр берётся из невыводимого контекста, поэтому форма на double
+// умножается и на 2, и на 2.0
+
+template <class T, class L, class R>
+FormBinary<T, typename FormOperand<L>::Type, typename FormOperand<R>::Type, FormPlus>
+operator+(const FormExpression<T, L>& left, const FormExpression<T, R>& right) {
+    return FormBinary<T, typename FormOperand<L>::Type, typename FormOperand<R>::Type, FormPlus>(
+        FormOperand<L>::Wrap(left.Self()), FormOperand<R>::Wrap(right.Self()));
+}
+
+template <class T, class L, class R>
+FormBinary<T, typename FormOperand<L>::Type, typename FormOperand<R>::Type, FormMinus>
+operator-(const FormExpression<T, L>& left, const FormExpression<T, R>& right) {
+    return FormBinary<T, typename FormOperand<L>::Type, typename FormOperand<R>::Type, FormMinus>(
+        FormOperand<L>::Wrap(left.Self()), FormOperand<R>::Wrap(right.Self()));
+}
+
+template <class T, class E>
+FormScaled<T, typename FormOperand<E>::Type>
+operator*(const FormExpression<T, E>& expression, const typename FormExpression<T, E>::Value& scalar) {
+    return FormScaled<T, typename FormOperand<E>::Type>(FormOperand<E>::Wrap(expression.Self()), scalar);
+}
+
+template <class T, class E>
+FormScaled<T, typename FormOperand<E>::Type>
+operator*(const typename FormExpression<T, E>::Value& scalar, const FormExpression<T, E>& expression) {
+    return expression * scalar;
+}
+
+// Как и LinearForm::Divide - умножение на обратный скаляр
+template <class T, class E>
+FormScaled<T, typename FormOperand<E>::Type>
+operator/(const FormExpression<T, E>& expression, const typename FormExpression<T, E>::Value& scalar) {
+    if (scalar == T(0)) {
+        throw std::invalid_argument("Division by zero");
+    }
+    return expression * (T(1) / scalar);
+}
+
+#endif
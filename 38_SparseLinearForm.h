@@ -0,0 +1,268 @@
+#ifndef SPARSE_LINEARFORM_H
+#define SPARSE_LINEARFORM_H
+
+#include <algorithm>
+#include <stdexcept>
+#include <sstream>
+#include "5_Linearform.h"
+
+// Разреженная линейная форма: хранятся только ненулевые коэффициенты, индексы по возрастанию
+// в одном массиве, значения - в другом. Индексы те же, что у LinearForm: 0 - свободный член,
+// i - коэффициент при x(i-1). Память и время операций зависят от числа ненулевых (nnz),
+// а не от длины; только Get и PartialDerivative ищут индекс двоичным поиском
+template <class T>
+class SparseLinearForm {
+public:
+    // Нулевая форма длины length
+    explicit SparseLinearForm(int length = 0);
+    // indices - строго по возрастанию и меньше length; нулевые значения отбрасываются
+    SparseLinearForm(const int* indices, const T* values, int count, int length);
+    explicit SparseLinearForm(const LinearForm<T>& dense);
+
+    T Get(int index) const;
+    int GetLength() const { return length; }
+    int GetNonZeroCount() const { return indices.GetSize(); }
+    // Ненулевые коэффициенты: k-й лежит по индексу GetIndex(k)
+    int GetIndex(int k) const { return indices.Get(k); }
+    T GetValue(int k) const { return values.Get(k); }
+
+    std::string ToString() const;
+    LinearForm<T> ToDense() const;
+
+    // Слиянием отсортированных индексов, O(nnz + other.nnz)
+    SparseLinearForm<T>* Add(const SparseLinearForm<T>& other) const;
+    SparseLinearForm<T>* Subtract(const SparseLinearForm<T>& other) const;
+    SparseLinearForm<T>* Multiply(const T& scalar) const;
+    SparseLinearForm<T>* Divide(const T& scalar) const;
+    // Смешанная сумма с плотной формой - плотная форма, O(length + nnz)
+    LinearForm<T>* Add(const LinearForm<T>& dense) const;
+
+    // Значение в плотной точке: берутся только координаты при ненулевых коэффициентах
+    T Evaluate(const ArraySequence<T>& variables) const;
+    // Градиент - тоже разреженный, длины GetLength() - 1: индекс i - производная по x(i)
+    SparseLinearForm<T>* Gradient() const;
+    T PartialDerivative(int variableIndex) const;
+
+private:
+    int length;
+    DynamicArray<int> indices;
+    DynamicArray<T> values;
+
+    // Позиция первого ненулевого с индексом >= index
+    int LowerBound(int index) const;
+
+    void Push(int index, const T& value) {
+        if (value != T(0)) {
+            indices.EmplaceBack(index);
+            values.EmplaceBack(value);
+        }
+    }
+
+    template <class Op> SparseLinearForm<T>* Merge(const SparseLinearForm<T>& other, Op op) const;
+
+    void CheckDimensions(int otherLength) const {
+        if (length != otherLength) {
+            throw std::invalid_argument("Linear forms have different dimensions");
+        }
+    }
+};
+
+// Реализации методов
+template <class T>
+SparseLinearForm<T>::SparseLinearForm(int length) : length(length), indices(0), values(0) {
+    if (length < 0) throw std::invalid_argument("Negative form length");
+}
+
+template <class T>
+SparseLinearForm<T>::SparseLinearForm(const int* items, const T* coefficients, int count, int length)
+    : length(length), indices(0), values(0) {
+    if (length < 0 || count < 0) throw std::invalid_argument("Negative form length");
+    indices.Reserve(count);
+    values.Reserve(count);
+    for (int k = 0; k < count; ++k) {
+        if (items[k] < 0 || items[k] >= length || (k > 0 && items[k] <= items[k - 1])) {
+            throw std::invalid_argument("Indices must be increasing and less than form length");
+        }
+        Push(items[k], coefficients[k]);
+    }
+}
+
+template <class T>
+SparseLinearForm<T>::SparseLinearForm(const LinearForm<T>& dense) : length(dense.GetLength()), indices(0), values(0) {
+    for (int i = 0; i < length; ++i) {
+        Push(i, dense.Get(i));
+    }
+}
+
+template <class T>
+int SparseLinearForm<T>::LowerBound(int index) const {
+    const int* first = indices.Data();
+    return static_cast<int>(std::lower_bound(first, first + indices.GetSize(), index) - first);
+}
+
+template <class T>
+T SparseLinearForm<T>::Get(int index) const {
+    if (index < 0 || index >= length) throw std::out_of_range("Index out of range");
+    int k = LowerBound(index);
+    return (k < GetNonZeroCount() && indices.Get(k) == index) ? values.Get(k) : T(0);
+}
+
+template <class T>
+std::string SparseLinearForm<T>::ToString() const {
+    if (GetNonZeroCount() == 0) return "F(x) = 0";
+
+    std::ostringstream oss;
+    oss << "F(x) = ";
+    for (int k = 0; k < GetNonZeroCount(); ++k) {
+        if (k > 0) oss << " + ";
+        oss << values.Get(k);
+        if (indices.Get(k) > 0) oss << "*x" << indices.Get(k);
+    }
+    return oss.str();
+}
+
+template <class T>
+LinearForm<T> SparseLinearForm<T>::ToDense() const {
+    DynamicArray<T> dense(length);
+    T* out = dense.Data();
+    std::fill(out, out + length, T(0));
+    for (int k = 0; k < GetNonZeroCount(); ++k) {
+        out[indices.Get(k)] = values.Get(k);
+    }
+    return LinearForm<T>(out, length);
+}
+
+template <class T>
+template <class Op>
+SparseLinearForm<T>* SparseLinearForm<T>::Merge(const SparseLinearForm<T>& other, Op op) const {
+    CheckDimensions(other.length);
+    SparseLinearForm<T>* result = new SparseLinearForm<T>(length);
+    try {
+        result->indices.Reserve(GetNonZeroCount() + other.GetNonZeroCount());
+        result->values.Reserve(GetNonZeroCount() + other.GetNonZeroCount());
+        const int* left = indices.Data();
+        const int* right = other.indices.Data();
+        const T* leftValues = values.Data();
+        const T* rightValues = other.values.Data();
+        int leftCount = GetNonZeroCount();
+        int rightCount = other.GetNonZeroCount();
+        int i = 0, j = 0;
+        while (i < leftCount || j < rightCount) {
+            if (j == rightCount || (i < leftCount && left[i] < right[j])) {
+                result->Push(left[i], op(leftValues[i], T(0)));
+                ++i;
+            } else if (i == leftCount || right[j] < left[i]) {
+                result->Push(right[j], op(T(0), rightValues[j]));
+                ++j;
+            } else {
+                result->Push(left[i], op(leftValues[i], rightValues[j]));
+                ++i;
+                ++j;
+            }
+        }
+    } catch (...) {
+        delete result;
+        throw;
+    }
+    return result;
+}
+
+template <class T>
+SparseLinearForm<T>* SparseLinearForm<T>::Add(const SparseLinearForm<T>& other) const {
+    return Merge(other, [](const T& a, const T& b) { return a + b; });
+}
+
+template <class T>
+SparseLinearForm<T>* SparseLinearForm<T>::Subtract(const SparseLinearForm<T>& other) const {
+    return Merge(other, [](const T& a, const T& b) { return a - b; });
+}
+
+template <class T>
+SparseLinearForm<T>* SparseLinearForm<T>::Multiply(const T& scalar) const {
+    SparseLinearForm<T>* result = new SparseLinearForm<T>(length);
+    try {
+        result->indices.Reserve(GetNonZeroCount());
+        result->values.Reserve(GetNonZeroCount());
+        for (int k = 0; k < GetNonZeroCount(); ++k) {
+            result->Push(indices.Get(k), values.Get(k) * scalar);
+        }
+    } catch (...) {
+        delete result;
+        throw;
+    }
+    return result;
+}
+
+template <class T>
+SparseLinearForm<T>* SparseLinearForm<T>::Divide(const T& scalar) const {
+    if (scalar == T(0)) {
+        throw std::invalid_argument("Division by zero");
+    }
+    return Multiply(T(1) / scalar);
+}
+
+template <class T>
+LinearForm<T>* SparseLinearForm<T>::Add(const LinearForm<T>& dense) const {
+    CheckDimensions(dense.GetLength());
+    DynamicArray<T> sum(length);
+    T* out = sum.Data();
+    for (int i = 0; i < length; ++i) {
+        out[i] = dense.Get(i);
+    }
+    for (int k = 0; k < GetNonZeroCount(); ++k) {
+        out[indices.Get(k)] += values.Get(k);
+    }
+    return new LinearForm<T>(out, length);
+}
+
+template <class T>
+T SparseLinearForm<T>::Evaluate(const ArraySequence<T>& variables) const {
+    if (variables.GetLength() != length - 1) {
+        throw std::invalid_argument("Number of variables doesn't match form dimension");
+    }
+
+    // Индексы отсортированы, поэтому итератор по переменным идёт только вперёд
+    typename ArraySequence<T>::ConstIterator x = variables.begin();
+    int position = 1;
+    const int* index = indices.Data();
+    const T* coefficient = values.Data();
+    int k = 0;
+    T result = T(0);
+    if (GetNonZeroCount() > 0 && index[0] == 0) {
+        result = coefficient[0];
+        k = 1;
+    }
+    for (; k < GetNonZeroCount(); ++k) {
+        x.Skip(index[k] - position);
+        position = index[k];
+        result += coefficient[k] * *x;
+    }
+    return result;
+}
+
+template <class T>
+SparseLinearForm<T>* SparseLinearForm<T>::Gradient() const {
+    SparseLinearForm<T>* result = new SparseLinearForm<T>(length > 0 ? length - 1 : 0);
+    try {
+        int first = (GetNonZeroCount() > 0 && indices.Get(0) == 0) ? 1 : 0;
+        result->indices.Reserve(GetNonZeroCount() - first);
+        result->values.Reserve(GetNonZeroCount() - first);
+        for (int k = first; k < GetNonZeroCount(); ++k) {
+            result->Push(indices.Get(k) - 1, values.Get(k));
+        }
+    } catch (...) {
+        delete result;
+        throw;
+    }
+    return result;
+}
+
+template <class T>
+T SparseLinearForm<T>::PartialDerivative(int variableIndex) const {
+    if (variableIndex < 0 || variableIndex >= length - 1) {
+        throw std::out_of_range("Variable index out of range");
+    }
+    return Get(variableIndex + 1);
+}
+
+#endif
@@ -0,0 +1,145 @@
+#include "1_ArraySequence.h"
+#include "38_SparseLinearForm.h"
+#include <iostream>
+#include <fstream>
+#include <cassert>
+#include <vector>
+
+void testSparseLinearForm() {
+    std::ofstream outFile("outputSparse.txt");
+    if (!outFile) {
+        std::cerr << "Не удалось открыть файл outputSparse.txt для записи" << std::endl;
+        return;
+    }
+
+    outFile << "=== Starting SparseLinearForm tests ===" << std::endl;
+
+    // Тест 1: построение и доступ по индексу
+    outFile << "\nTest 1: Construction and Get...";
+    int indices[] = {0, 3, 7};
+    double values[] = {1.5, -2.0, 4.0};
+    SparseLinearForm<double> form(indices, values, 3, 10);
+    assert(form.GetLength() == 10 && form.GetNonZeroCount() == 3);
+    assert(form.Get(0) == 1.5 && form.Get(3) == -2.0 && form.Get(7) == 4.0 && form.Get(5) == 0.0);
+    assert(form.GetIndex(1) == 3 && form.GetValue(2) == 4.0);
+    assert(form.ToString() == "F(x) = 1.5 + -2*x3 + 4*x7");
+
+    double denseItems[] = {0.0, 2.0, 0.0, 0.0, 5.0};
+    LinearForm<double> dense(denseItems, 5);
+    SparseLinearForm<double> fromDense(dense);
+    assert(fromDense.GetNonZeroCount() == 2 && fromDense.Get(4) == 5.0);
+    LinearForm<double> back = fromDense.ToDense();
+    assert(back.GetLength() == 5 && back.Get(1) == 2.0 && back.Get(0) == 0.0);
+
+    int zeroIndices[] = {2, 4};
+    double zeroValues[] = {0.0, 1.0};
+    SparseLinearForm<double> skipped(zeroIndices, zeroValues, 2, 5);
+    assert(skipped.GetNonZeroCount() == 1);
+    outFile << " " << form.ToString() << " ✓" << std::endl;
+
+    // Тест 2: слияние при сложении и вычитании
+    outFile << "\nTest 2: Merge-based Add / Subtract...";
+    int otherIndices[] = {3, 5, 9};
+    double otherValues[] = {2.0, 1.0, -3.0};
+    SparseLinearForm<double> other(otherIndices, otherValues, 3, 10);
+    SparseLinearForm<double>* sum = form.Add(other);
+    // x3 сокращается и в результат не попадает
+    assert(sum->GetNonZeroCount() == 4 && sum->Get(3) == 0.0 && sum->Get(5) == 1.0 && sum->Get(9) == -3.0);
+    SparseLinearForm<double>* difference = form.Subtract(form);
+    assert(difference->GetNonZeroCount() == 0 && difference->GetLength() == 10);
+    SparseLinearForm<double>* scaled = form.Multiply(2.0);
+    assert(scaled->Get(7) == 8.0 && scaled->GetNonZeroCount() == 3);
+    SparseLinearForm<double>* halved = form.Divide(2.0);
+    assert(halved->Get(0) == 0.75);
+    SparseLinearForm<double>* zero = form.Multiply(0.0);
+    assert(zero->GetNonZeroCount() == 0);
+    delete sum;
+    delete difference;
+    delete scaled;
+    delete halved;
+    delete zero;
+
+    LinearForm<double>* mixed = fromDense.Add(dense);
+    assert(mixed->Get(1) == 4.0 && mixed->Get(4) == 10.0 && mixed->Get(2) == 0.0);
+    delete mixed;
+    outFile << " ✓" << std::endl;
+
+    // Тест 3: значение, градиент, частные производные
+    outFile << "\nTest 3: Evaluate / Gradient...";
+    std::vector<double> x(9);
+    for (int i = 0; i < 9; ++i) {
+        x[i] = i + 1.0;
+    }
+    MutableArraySequence<double> point(x.data(), 9);
+    assert(form.Evaluate(point) == 1.5 - 2.0 * 3.0 + 4.0 * 7.0);
+    assert(form.Evaluate(point) == form.ToDense().Evaluate(point));
+    assert(other.Evaluate(point) == 2.0 * 3.0 + 1.0 * 5.0 - 3.0 * 9.0);
+
+    SparseLinearForm<double>* gradient = form.Gradient();
+    assert(gradient->GetLength() == 9 && gradient->GetNonZeroCount() == 2);
+    assert(gradient->Get(2) == -2.0 && gradient->Get(6) == 4.0);
+    delete gradient;
+    assert(form.PartialDerivative(2) == -2.0 && form.PartialDerivative(0) == 0.0);
+    outFile << " ✓" << std::endl;
+
+    // Тест 4: миллион переменных и несколько сотен ненулевых
+    outFile << "\nTest 4: Large sparse form...";
+    const int length = 1000001;
+    std::vector<int> wideIndices;
+    std::vector<int> wideValues;
+    for (int i = 1; i < length; i += 4001) {
+        wideIndices.push_back(i);
+        wideValues.push_back(i % 7 - 3);
+    }
+    SparseLinearForm<int> wide(wideIndices.data(), wideValues.data(), static_cast<int>(wideIndices.size()), length);
+    SparseLinearForm<int>* twice = wide.Add(wide);
+    assert(twice->GetNonZeroCount() == wide.GetNonZeroCount() && twice->Get(4002) == 2 * wide.Get(4002));
+    delete twice;
+    std::vector<int> ones(length - 1, 1);
+    MutableArraySequence<int> onesPoint(ones.data(), length - 1);
+    int expected = 0;
+    for (int value : wideValues) {
+        expected += value;
+    }
+    assert(wide.Evaluate(onesPoint) == expected);
+    outFile << " nnz " << wide.GetNonZeroCount() << " ✓" << std::endl;
+
+    // Тест 5: ошибки
+    outFile << "\nTest 5: Errors...";
+    bool thrown = false;
+    try {
+        int unsorted[] = {4, 2};
+        SparseLinearForm<double> bad(unsorted, values, 2, 10);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+    thrown = false;
+    try {
+        SparseLinearForm<double>* bad = form.Add(fromDense);
+        delete bad;
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+    thrown = false;
+    try {
+        form.Evaluate(MutableArraySequence<double>(x.data(), 3));
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+    thrown = false;
+    try {
+        form.PartialDerivative(9);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    outFile << " ✓" << std::endl;
+
+    outFile << "\n=== All SparseLinearForm tests passed successfully! ===" << std::endl;
+
+    outFile.close();
+    std::cout << "Тесты завершены. Результаты записаны в outputSparse.txt" << std::endl;
+}
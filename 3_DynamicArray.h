@@ -4,51 +4,268 @@
 #include <stdexcept>
 #include <sstream>
 #include <string>
+#include <new>
+#include <utility>
+#include <atomic>
+#include <type_traits>
+#include <iterator>
+#include <algorithm>
+#include <cstring>
+#include "19_MemoryResource.h"
 
 template <class T> class DynamicArray
     {
         public:
-            DynamicArray(T* items, int count);
-            DynamicArray(int size);
+            DynamicArray(T* items, int count, MemoryResource* resource = DefaultResource());
+            DynamicArray(int size, MemoryResource* resource = DefaultResource());
+            template <class InputIt, class = typename std::iterator_traits<InputIt>::iterator_category>
+            DynamicArray(InputIt first, InputIt last, MemoryResource* resource = DefaultResource());
             DynamicArray(const DynamicArray<T>& other);
+            DynamicArray(const DynamicArray<T>& other, MemoryResource* resource);
+            DynamicArray(DynamicArray<T>&& other) noexcept;
 
             ~DynamicArray();
 
             T Get(int index) const;
             int GetSize() const;
+            int Capacity() const;
             void Set(int index, T value);
             void Resize(int newSize);
+            void Reserve(int newCapacity);
+            void ShrinkToFit();
+            MemoryResource* GetResource() const;
+
+            // Элементы лежат подряд, итераторы - обычные указатели.
+            // Неконстантные версии отделяют общий буфер, указатель действителен до следующего копирования массива
+            T* Data();
+            const T* Data() const;
+            T* begin();
+            T* end();
+            const T* begin() const;
+            const T* end() const;
+
+            template <class... Args> T& Emplace(int index, Args&&... args);
+            template <class... Args> T& EmplaceBack(Args&&... args);
+
+            // Вставка диапазона: место выделяется один раз, тривиально копируемые T
+            // из указателей копируются memcpy/memmove. Диапазон может лежать в самом массиве
+            template <class InputIt> void AppendRange(InputIt first, InputIt last);
+            template <class InputIt> void InsertRange(int index, InputIt first, InputIt last);
+            template <class ForwardIt> void InsertN(int index, ForwardIt first, int count);
 
             DynamicArray& operator= (const DynamicArray<T>& other);
+            DynamicArray& operator= (DynamicArray<T>&& other) noexcept;
             std::string ToString() const;
 
+            bool IsShared() const;
+
+            // Сколько байт ресурса займёт буфер на count элементов (со счётчиком ссылок) -
+            // по этому размеру заводят InlineResource под небольшие массивы
+            static constexpr std::size_t BytesFor(int count) { return HEADER + sizeof(T) * count; }
+
         private:
+            // buffer - сырая память на capacity элементов, сконструированы только первые size.
+            // Перед буфером лежит счётчик ссылок: копии массива из того же ресурса делят буфер,
+            // а изменяющий метод сначала отделяет свою копию (copy-on-write). Счётчик атомарный,
+            // поэтому копии одного буфера можно читать и менять из разных потоков
             T* buffer;
-            int size;    
+            int size;
+            int capacity;
+            MemoryResource* resource;
+
+            typedef std::atomic<int> RefCount;
+            static constexpr std::size_t ALIGNMENT = alignof(T) > alignof(RefCount) ? alignof(T) : alignof(RefCount);
+            static constexpr std::size_t HEADER = (sizeof(RefCount) + alignof(T) - 1) / alignof(T) * alignof(T);
+
+            T* Allocate(int count);
+            void Deallocate(T* memory, int count);
+            static void Destroy(T* first, T* last);
+            static RefCount& Refs(T* memory);
+            void Release();
+            void TransferTo(T* target, int gapIndex, int gapSize, int& transferred);
+            void DestroyTransferred(T* target, int gapIndex, int gapSize, int transferred);
+            static void Transfer(T* target, T& source, bool copy, std::true_type);
+            static void Transfer(T* target, T& source, bool copy, std::false_type);
+            void Detach();
+
+            int GrownCapacity(int required) const;
+            void Reallocate(int newCapacity);
+
+            // Источник - указатель на тривиально копируемые T: можно копировать memcpy
+            template <class It> struct RawSource
+                : std::integral_constant<bool, std::is_trivially_copyable<T>::value &&
+                      (std::is_same<It, T*>::value || std::is_same<It, const T*>::value)> {};
+
+            template <class It> void InsertRangeDispatch(int index, It first, It last, std::input_iterator_tag);
+            template <class It> void InsertRangeDispatch(int index, It first, It last, std::forward_iterator_tag);
+            template <class It> void ConstructRange(T* target, It first, int count, int& built, std::true_type);
+            template <class It> void ConstructRange(T* target, It first, int count, int& built, std::false_type);
+            template <class It> void InsertInPlace(int index, It first, int count, std::true_type);
+            template <class It> void InsertInPlace(int index, It first, int count, std::false_type);
     };
 
+template <class T> constexpr std::size_t DynamicArray<T>::ALIGNMENT;
+template <class T> constexpr std::size_t DynamicArray<T>::HEADER;
+
 //////////////////////////////////////////////////////////////////////
 
-template <class T> DynamicArray<T>::DynamicArray(T* items, int count) : size(count) {
-    buffer = new T[size];
-    for (int i = 0; i < size; ++i) {
-        buffer[i] = items[i];
+template <class T> T* DynamicArray<T>::Allocate(int count) {
+    if (count == 0) return nullptr;
+    char* memory = static_cast<char*>(resource->Allocate(HEADER + sizeof(T) * count, ALIGNMENT));
+    new (memory) RefCount(1);
+    return reinterpret_cast<T*>(memory + HEADER);
+}
+
+template <class T> void DynamicArray<T>::Deallocate(T* memory, int count) {
+    if (memory == nullptr) return;
+    resource->Deallocate(reinterpret_cast<char*>(memory) - HEADER, HEADER + sizeof(T) * count, ALIGNMENT);
+}
+
+template <class T> void DynamicArray<T>::Destroy(T* first, T* last) {
+    for (; first != last; ++first) {
+        first->~T();
     }
 }
 
-template <class T> DynamicArray<T>::DynamicArray(int size) : size(size) {
-    buffer = new T[size];
+template <class T> typename DynamicArray<T>::RefCount& DynamicArray<T>::Refs(T* memory) {
+    return *reinterpret_cast<RefCount*>(reinterpret_cast<char*>(memory) - HEADER);
 }
 
-template <class T> DynamicArray<T>::DynamicArray(const DynamicArray<T>& other) : size(other.size) {
-    buffer = new T[size];
-    for (int i = 0; i < size; ++i) {
-        buffer[i] = other.buffer[i];
+template <class T> bool DynamicArray<T>::IsShared() const {
+    return buffer != nullptr && Refs(buffer).load(std::memory_order_acquire) > 1;
+}
+
+// Отпускает буфер; элементы разрушает последний владелец
+template <class T> void DynamicArray<T>::Release() {
+    if (buffer != nullptr && Refs(buffer).fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        Destroy(buffer, buffer + size);
+        Deallocate(buffer, capacity);
+    }
+}
+
+// Переносит элементы в новый буфер: собственные перемещаются, если это не бросает исключений,
+// иначе и из общего буфера копируются. Элементы с индекса gapIndex сдвигаются на gapSize,
+// оставляя место под вставку. transferred - сколько элементов уже сконструировано в target
+template <class T> void DynamicArray<T>::TransferTo(T* target, int gapIndex, int gapSize, int& transferred) {
+    if (std::is_trivially_copyable<T>::value) {
+        if (size > 0) {
+            std::memcpy(static_cast<void*>(target), buffer, sizeof(T) * gapIndex);
+            std::memcpy(static_cast<void*>(target + gapIndex + gapSize), buffer + gapIndex, sizeof(T) * (size - gapIndex));
+        }
+        transferred = size;
+        return;
+    }
+
+    bool copy = IsShared() || !std::is_nothrow_move_constructible<T>::value;
+    for (; transferred < size; ++transferred) {
+        int position = transferred < gapIndex ? transferred : transferred + gapSize;
+        Transfer(target + position, buffer[transferred], copy, std::is_copy_constructible<T>());
     }
 }
 
+template <class T> void DynamicArray<T>::DestroyTransferred(T* target, int gapIndex, int gapSize, int transferred) {
+    for (int i = 0; i < transferred; ++i) {
+        target[i < gapIndex ? i : i + gapSize].~T();
+    }
+}
+
+template <class T> void DynamicArray<T>::Transfer(T* target, T& source, bool copy, std::true_type) {
+    if (copy) {
+        new (target) T(static_cast<const T&>(source));
+    }
+    else {
+        new (target) T(std::move(source));
+    }
+}
+
+// Некопируемый T: массив с таким T не копируется, значит и буфер ни с кем не делится
+template <class T> void DynamicArray<T>::Transfer(T* target, T& source, bool, std::false_type) {
+    new (target) T(std::move(source));
+}
+
+template <class T> void DynamicArray<T>::Detach() {
+    if (IsShared()) {
+        Reallocate(capacity);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+
+template <class T> DynamicArray<T>::DynamicArray(T* items, int count, MemoryResource* resource)
+    : size(0), capacity(count), resource(resource) {
+    if (count < 0) {
+        throw std::invalid_argument("Invalid size");
+    }
+    buffer = Allocate(capacity);
+    try {
+        for (; size < count; ++size) {
+            new (buffer + size) T(items[size]);
+        }
+    } catch (...) {
+        Destroy(buffer, buffer + size);
+        Deallocate(buffer, capacity);
+        throw;
+    }
+}
+
+template <class T> DynamicArray<T>::DynamicArray(int count, MemoryResource* resource)
+    : size(0), capacity(count), resource(resource) {
+    if (count < 0) {
+        throw std::invalid_argument("Invalid size");
+    }
+    buffer = Allocate(capacity);
+    try {
+        for (; size < count; ++size) {
+            new (buffer + size) T();
+        }
+    } catch (...) {
+        Destroy(buffer, buffer + size);
+        Deallocate(buffer, capacity);
+        throw;
+    }
+}
+
+template <class T> template <class InputIt, class>
+DynamicArray<T>::DynamicArray(InputIt first, InputIt last, MemoryResource* resource)
+    : DynamicArray(0, resource) {
+    AppendRange(first, last);
+}
+
+template <class T> DynamicArray<T>::DynamicArray(const DynamicArray<T>& other)
+    : DynamicArray(other, other.resource) {}
+
+template <class T> DynamicArray<T>::DynamicArray(const DynamicArray<T>& other, MemoryResource* resource)
+    : size(0), capacity(other.size), resource(resource) {
+    // Буфер из того же ресурса не копируем, а делим
+    if (resource == other.resource && other.buffer != nullptr) {
+        buffer = other.buffer;
+        size = other.size;
+        capacity = other.capacity;
+        Refs(buffer).fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    buffer = Allocate(capacity);
+    try {
+        for (; size < other.size; ++size) {
+            new (buffer + size) T(other.buffer[size]);
+        }
+    } catch (...) {
+        Destroy(buffer, buffer + size);
+        Deallocate(buffer, capacity);
+        throw;
+    }
+}
+
+template <class T> DynamicArray<T>::DynamicArray(DynamicArray<T>&& other) noexcept
+    : buffer(other.buffer), size(other.size), capacity(other.capacity), resource(other.resource) {
+    other.buffer = nullptr;
+    other.size = 0;
+    other.capacity = 0;
+}
+
 template <class T> DynamicArray<T>::~DynamicArray() {
-    delete[] buffer;
+    Release();
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -64,44 +281,306 @@ template <class T> int DynamicArray<T>::GetSize() const{
     return size;
 }
 
+template <class T> int DynamicArray<T>::Capacity() const{
+    return capacity;
+}
+
+template <class T> MemoryResource* DynamicArray<T>::GetResource() const{
+    return resource;
+}
+
+template <class T> T* DynamicArray<T>::Data() {
+    Detach();
+    return buffer;
+}
+
+template <class T> const T* DynamicArray<T>::Data() const {
+    return buffer;
+}
+
+template <class T> T* DynamicArray<T>::begin() {
+    return Data();
+}
+
+template <class T> T* DynamicArray<T>::end() {
+    return Data() + size;
+}
+
+template <class T> const T* DynamicArray<T>::begin() const {
+    return buffer;
+}
+
+template <class T> const T* DynamicArray<T>::end() const {
+    return buffer + size;
+}
+
 template <class T> void DynamicArray<T>::Set(int index, T value) {
     if (index < 0 || index >= size) {
         throw std::out_of_range("Index out of range");
     }
-    buffer[index] = value;
+    Detach();
+    buffer[index] = std::move(value);
 }
 
 //////////////////////////////////////////////////////////////////////
 
+// Ёмкость растёт геометрически (x2), поэтому серия Resize(size + 1)
+// даёт амортизированное O(1) на добавление. Уменьшение размера память не отдаёт,
+// для этого есть ShrinkToFit.
 template <class T> void DynamicArray<T>::Resize(int newSize) {
     if (newSize < 0) {
         throw std::invalid_argument("Invalid size");
     }
 
-    if (newSize == size) {
+    if (newSize > capacity) {
+        Reallocate(GrownCapacity(newSize));
+    }
+    else if (newSize != size) {
+        Detach();
+    }
+    while (size < newSize) {
+        new (buffer + size) T();
+        ++size;
+    }
+    if (newSize < size) {
+        Destroy(buffer + newSize, buffer + size);
+        size = newSize;
+    }
+}
+
+template <class T> void DynamicArray<T>::Reserve(int newCapacity) {
+    if (newCapacity < 0) {
+        throw std::invalid_argument("Invalid capacity");
+    }
+
+    if (newCapacity > capacity) {
+        Reallocate(newCapacity);
+    }
+}
+
+template <class T> void DynamicArray<T>::ShrinkToFit() {
+    if (capacity != size) {
+        Reallocate(size);
+    }
+}
+
+template <class T> int DynamicArray<T>::GrownCapacity(int required) const {
+    int grown = capacity * 2;
+    return required > grown ? required : grown;
+}
+
+// Переносит элементы в новый буфер (см. TransferTo). При ошибке старый буфер остаётся нетронутым.
+template <class T> void DynamicArray<T>::Reallocate(int newCapacity) {
+    T* newBuffer = Allocate(newCapacity);
+    int moved = 0;
+    try {
+        TransferTo(newBuffer, size, 0, moved);
+    } catch (...) {
+        Destroy(newBuffer, newBuffer + moved);
+        Deallocate(newBuffer, newCapacity);
+        throw;
+    }
+
+    Release();
+    buffer = newBuffer;
+    capacity = newCapacity;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+template <class T> template <class... Args> T& DynamicArray<T>::EmplaceBack(Args&&... args) {
+    bool shared = IsShared();
+    if (size < capacity && !shared) {
+        new (buffer + size) T(std::forward<Args>(args)...);
+        return buffer[size++];
+    }
+
+    // Новый элемент строится до переноса старых: аргументы могут ссылаться на них
+    int newCapacity = size < capacity ? capacity : GrownCapacity(size + 1);
+    T* newBuffer = Allocate(newCapacity);
+    int moved = 0;
+    try {
+        new (newBuffer + size) T(std::forward<Args>(args)...);
+        try {
+            TransferTo(newBuffer, size, 0, moved);
+        } catch (...) {
+            newBuffer[size].~T();
+            throw;
+        }
+    } catch (...) {
+        Destroy(newBuffer, newBuffer + moved);
+        Deallocate(newBuffer, newCapacity);
+        throw;
+    }
+
+    Release();
+    buffer = newBuffer;
+    capacity = newCapacity;
+    return buffer[size++];
+}
+
+template <class T> template <class... Args> T& DynamicArray<T>::Emplace(int index, Args&&... args) {
+    if (index < 0 || index > size) {
+        throw std::out_of_range("Index out of range");
+    }
+    if (index == size) {
+        return EmplaceBack(std::forward<Args>(args)...);
+    }
+
+    T item(std::forward<Args>(args)...);
+    if (size == capacity) {
+        Reallocate(GrownCapacity(size + 1));
+    }
+    else {
+        Detach();
+    }
+    new (buffer + size) T(std::move(buffer[size - 1]));
+    ++size;
+    for (int i = size - 2; i > index; --i) {
+        buffer[i] = std::move(buffer[i - 1]);
+    }
+    buffer[index] = std::move(item);
+    return buffer[index];
+}
+
+template <class T> template <class InputIt> void DynamicArray<T>::AppendRange(InputIt first, InputIt last) {
+    InsertRange(size, first, last);
+}
+
+template <class T> template <class InputIt> void DynamicArray<T>::InsertRange(int index, InputIt first, InputIt last) {
+    InsertRangeDispatch(index, first, last, typename std::iterator_traits<InputIt>::iterator_category());
+}
+
+// Однопроходный диапазон: длина заранее неизвестна, собираем его отдельно
+template <class T> template <class It> void DynamicArray<T>::InsertRangeDispatch(int index, It first, It last, std::input_iterator_tag) {
+    if (index < 0 || index > size) {
+        throw std::out_of_range("Index out of range");
+    }
+    DynamicArray<T> buffered(0, resource);
+    for (; first != last; ++first) {
+        buffered.EmplaceBack(*first);
+    }
+    InsertN(index, std::make_move_iterator(buffered.begin()), buffered.size);
+}
+
+template <class T> template <class It> void DynamicArray<T>::InsertRangeDispatch(int index, It first, It last, std::forward_iterator_tag) {
+    InsertN(index, first, static_cast<int>(std::distance(first, last)));
+}
+
+template <class T> template <class ForwardIt> void DynamicArray<T>::InsertN(int index, ForwardIt first, int count) {
+    if (index < 0 || index > size) {
+        throw std::out_of_range("Index out of range");
+    }
+    if (count < 0) {
+        throw std::invalid_argument("Invalid size");
+    }
+    if (count == 0) {
         return;
     }
 
-    T* newBuffer = new T[newSize];
-    int elementsToCopy = (size < newSize) ? size : newSize;
+    bool fits = size + count <= capacity;
+    if (fits && !IsShared()) {
+        InsertInPlace(index, first, count, RawSource<ForwardIt>());
+        return;
+    }
 
-    for (int i = 0; i < elementsToCopy; ++i) {
-        newBuffer[i] = buffer[i];
+    // Новые элементы строятся до переноса старых: диапазон может ссылаться на них
+    int newCapacity = fits ? capacity : GrownCapacity(size + count);
+    T* newBuffer = Allocate(newCapacity);
+    int built = 0;
+    int moved = 0;
+    try {
+        ConstructRange(newBuffer + index, first, count, built, RawSource<ForwardIt>());
+        TransferTo(newBuffer, index, count, moved);
+    } catch (...) {
+        Destroy(newBuffer + index, newBuffer + index + built);
+        DestroyTransferred(newBuffer, index, count, moved);
+        Deallocate(newBuffer, newCapacity);
+        throw;
     }
 
-    delete[] buffer;
+    Release();
     buffer = newBuffer;
-    size = newSize;
+    capacity = newCapacity;
+    size += count;
+}
+
+template <class T> template <class It> void DynamicArray<T>::ConstructRange(T* target, It first, int count, int& built, std::true_type) {
+    std::memcpy(static_cast<void*>(target), first, sizeof(T) * count);
+    built = count;
 }
 
+template <class T> template <class It> void DynamicArray<T>::ConstructRange(T* target, It first, int count, int& built, std::false_type) {
+    for (; built < count; ++built, ++first) {
+        new (target + built) T(*first);
+    }
+}
+
+template <class T> template <class It> void DynamicArray<T>::InsertInPlace(int index, It first, int count, std::true_type) {
+    const T* source = first;
+    if (source + count > buffer && source < buffer + size) {
+        // Вставка куска самого массива: memmove испортил бы источник
+        InsertInPlace(index, first, count, std::false_type());
+        return;
+    }
+    std::memmove(static_cast<void*>(buffer + index + count), buffer + index, sizeof(T) * (size - index));
+    std::memcpy(static_cast<void*>(buffer + index), source, sizeof(T) * count);
+    size += count;
+}
+
+// Дописываем новые элементы в конец и поворачиваем хвост на место.
+// Если копирование бросит исключение, массив остаётся прежним
+template <class T> template <class It> void DynamicArray<T>::InsertInPlace(int index, It first, int count, std::false_type) {
+    int oldSize = size;
+    try {
+        for (int i = 0; i < count; ++i, ++first) {
+            new (buffer + size) T(*first);
+            ++size;
+        }
+    } catch (...) {
+        Destroy(buffer + oldSize, buffer + size);
+        size = oldSize;
+        throw;
+    }
+    std::rotate(buffer + index, buffer + oldSize, buffer + size);
+}
+
+//////////////////////////////////////////////////////////////////////
+
 template <class T> DynamicArray<T>& DynamicArray<T>::operator=(const DynamicArray<T>& other) {
     if (this != &other) {
-        delete[] buffer;
-        size = other.size;
-        buffer = new T[size];
-        for (int i = 0; i < size; ++i) {
+        // Общий буфер или нехватка места - строим копию; иначе переиспользуем свой буфер
+        if (resource == other.resource || capacity < other.size || IsShared()) {
+            DynamicArray<T> copy(other, resource);
+            *this = std::move(copy);
+            return *this;
+        }
+
+        int common = (size < other.size) ? size : other.size;
+        for (int i = 0; i < common; ++i) {
             buffer[i] = other.buffer[i];
         }
+        if (size > other.size) {
+            Destroy(buffer + other.size, buffer + size);
+            size = other.size;
+        }
+        for (; size < other.size; ++size) {
+            new (buffer + size) T(other.buffer[size]);
+        }
+    }
+    return *this;
+}
+
+template <class T> DynamicArray<T>& DynamicArray<T>::operator=(DynamicArray<T>&& other) noexcept {
+    if (this != &other) {
+        Release();
+        buffer = other.buffer;
+        size = other.size;
+        capacity = other.capacity;
+        resource = other.resource;
+        other.buffer = nullptr;
+        other.size = 0;
+        other.capacity = 0;
     }
     return *this;
 }
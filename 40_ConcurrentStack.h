@@ -0,0 +1,325 @@
+#ifndef CONCURRENT_STACK_H
+#define CONCURRENT_STACK_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <utility>
+#include "7_Stack.h"
+
+// Стек без блокировок (стек Трайбера) для общего пула задач нескольких потоков.
+// Узлы лежат в пачках, которые живут до разрушения стека, и адресуются 32-битным индексом.
+// Вершина - 64-битное слово: индекс узла и счётчик-метка, который растёт при каждой смене
+// вершины. Поэтому CAS не спутает вершину с тем же узлом, снятым и снова положенным (ABA),
+// а чтение next у узла, который другой поток уже снял, безопасно: память узла не освобождается.
+// Снятые узлы идут в такой же список свободных и используются повторно.
+// Snapshot читает цепочку от вершины, ничего не снимая. Пока идёт хотя бы одно такое чтение,
+// снятый узел не разрушается и не переиспользуется: TryPop копирует значение и откладывает узел
+// в список retired, последний закончивший читатель возвращает отложенные узлы в список свободных.
+template <class T>
+class ConcurrentStack {
+public:
+    ConcurrentStack();
+    virtual ~ConcurrentStack();
+
+    ConcurrentStack(const ConcurrentStack&) = delete;
+    ConcurrentStack& operator=(const ConcurrentStack&) = delete;
+
+    // Виртуальные: EliminationStack подменяет их, в том числе при вызове через ConcurrentStack<T>&
+    // false - закончились индексы узлов (около 2 миллиардов)
+    virtual bool TryPush(T item);
+    // false - стек пуст
+    virtual bool TryPop(T& out);
+
+    // Число элементов; при одновременных Push/Pop - приблизительное, но не меньше нуля:
+    // Push увеличивает счётчик до того, как узел появится на вершине, Pop уменьшает - после снятия
+    int GetLength() const { return length.load(std::memory_order_relaxed); }
+    bool IsEmpty() const { return Index(top.load(std::memory_order_acquire)) == NIL; }
+
+    // Снимок: копия элементов, лежавших в стеке в момент чтения вершины. Стек при этом
+    // не меняется, другие потоки продолжают класть и снимать. Порядок как у Stack:
+    // последний положенный - вершина
+    Stack<T>* Snapshot();
+    Stack<T>* Map(T (*f)(T));
+    Stack<T>* Where(bool (*f)(T));
+    T Reduce(T (*f)(T, T), T initial);
+
+protected:
+    typedef std::uint32_t Handle;
+    typedef std::uint64_t Tagged;
+
+    struct Node
+        {
+            alignas(T) unsigned char storage[sizeof(T)];
+            std::atomic<Handle> next;
+            // Связь в списке retired: next отложенного узла ещё может проходить читатель
+            std::atomic<Handle> retiredNext;
+
+            T* Value() { return reinterpret_cast<T*>(storage); }
+        };
+
+    // Пачка c содержит FIRST_CHUNK * 2^c узлов
+    static const Handle NIL = 0xFFFFFFFFu;
+    static const Handle FIRST_CHUNK = 64;
+    static const int MAX_CHUNKS = 25;
+
+    std::atomic<Tagged> top;
+    std::atomic<Tagged> freeList;
+    std::atomic<Handle> allocated;
+    std::atomic<int> length;
+    std::atomic<Node*> chunks[MAX_CHUNKS];
+    // Число идущих Snapshot и узлы, снятые во время них
+    std::atomic<int> readers;
+    std::atomic<Handle> retired;
+
+    static Handle Index(Tagged word) { return static_cast<Handle>(word); }
+    static Tagged Pack(Handle index, Tagged previous) {
+        return (((previous >> 32) + 1) << 32) | index;
+    }
+
+    Node& At(Handle index);
+    Handle AllocateNode();
+    void PushNode(std::atomic<Tagged>& list, Handle index);
+    Handle PopNode(std::atomic<Tagged>& list);
+    void Retire(Handle first, Handle last);
+    void EndRead();
+
+    // Одна попытка CAS на вершине - для надстроек с отступлением (EliminationStack).
+    // TryPopNode возвращает NIL и при пустом стеке (empty = true), и при проигранном CAS
+    bool TryPushNode(Handle index);
+    Handle TryPopNode(bool& empty);
+    // Перемещает значение узла в out и возвращает узел в список свободных
+    void TakeValue(Handle index, T& out);
+};
+
+template <class T> const typename ConcurrentStack<T>::Handle ConcurrentStack<T>::NIL;
+template <class T> const typename ConcurrentStack<T>::Handle ConcurrentStack<T>::FIRST_CHUNK;
+template <class T> const int ConcurrentStack<T>::MAX_CHUNKS;
+
+template <class T>
+ConcurrentStack<T>::ConcurrentStack()
+    : top(Tagged(NIL)), freeList(Tagged(NIL)), allocated(0), length(0), readers(0), retired(NIL) {
+    for (int c = 0; c < MAX_CHUNKS; ++c) {
+        chunks[c].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+template <class T>
+ConcurrentStack<T>::~ConcurrentStack() {
+    for (Handle index = Index(top.load()); index != NIL; index = At(index).next.load()) {
+        At(index).Value()->~T();
+    }
+    for (Handle index = retired.load(); index != NIL; index = At(index).retiredNext.load()) {
+        At(index).Value()->~T();
+    }
+    for (int c = 0; c < MAX_CHUNKS; ++c) {
+        delete[] chunks[c].load();
+    }
+}
+
+// Индекс i лежит в пачке c = floor(log2(i / FIRST_CHUNK + 1))
+template <class T>
+typename ConcurrentStack<T>::Node& ConcurrentStack<T>::At(Handle index) {
+    Handle scaled = index / FIRST_CHUNK + 1;
+    int c = 31 - __builtin_clz(scaled);
+    Handle chunkStart = FIRST_CHUNK * ((Handle(1) << c) - 1);
+    return chunks[c].load(std::memory_order_acquire)[index - chunkStart];
+}
+
+// Свободный узел из списка или новый; пачку, в которую попал новый индекс, создаёт
+// первый дошедший до неё поток, остальные удаляют свою копию
+template <class T>
+typename ConcurrentStack<T>::Handle ConcurrentStack<T>::AllocateNode() {
+    Handle index = PopNode(freeList);
+    if (index != NIL) return index;
+
+    Handle limit = FIRST_CHUNK * ((Handle(1) << MAX_CHUNKS) - 1);
+    index = allocated.fetch_add(1, std::memory_order_relaxed);
+    if (index >= limit) {
+        allocated.store(limit, std::memory_order_relaxed);
+        return NIL;
+    }
+    int c = 31 - __builtin_clz(index / FIRST_CHUNK + 1);
+    if (chunks[c].load(std::memory_order_acquire) == nullptr) {
+        Node* chunk = new Node[FIRST_CHUNK << c];
+        Node* expected = nullptr;
+        if (!chunks[c].compare_exchange_strong(expected, chunk, std::memory_order_acq_rel)) {
+            delete[] chunk;
+        }
+    }
+    return index;
+}
+
+template <class T>
+void ConcurrentStack<T>::PushNode(std::atomic<Tagged>& list, Handle index) {
+    Node& node = At(index);
+    Tagged head = list.load(std::memory_order_relaxed);
+    do {
+        node.next.store(Index(head), std::memory_order_relaxed);
+    } while (!list.compare_exchange_weak(head, Pack(index, head), std::memory_order_release,
+                                         std::memory_order_relaxed));
+}
+
+template <class T>
+typename ConcurrentStack<T>::Handle ConcurrentStack<T>::PopNode(std::atomic<Tagged>& list) {
+    Tagged head = list.load(std::memory_order_acquire);
+    while (Index(head) != NIL) {
+        // next может оказаться устаревшим, если узел уже сняли, - тогда не сойдётся метка.
+        // seq_cst - для пары с Snapshot (см. TakeValue)
+        Handle next = At(Index(head)).next.load(std::memory_order_relaxed);
+        if (list.compare_exchange_weak(head, Pack(next, head), std::memory_order_seq_cst,
+                                       std::memory_order_acquire)) {
+            return Index(head);
+        }
+    }
+    return NIL;
+}
+
+template <class T>
+bool ConcurrentStack<T>::TryPush(T item) {
+    Handle index = AllocateNode();
+    if (index == NIL) return false;
+    try {
+        new (At(index).Value()) T(std::move(item));
+    } catch (...) {
+        PushNode(freeList, index);
+        throw;
+    }
+    length.fetch_add(1, std::memory_order_relaxed);
+    PushNode(top, index);
+    return true;
+}
+
+template <class T>
+bool ConcurrentStack<T>::TryPop(T& out) {
+    Handle index = PopNode(top);
+    if (index == NIL) return false;
+    length.fetch_sub(1, std::memory_order_relaxed);
+    TakeValue(index, out);
+    return true;
+}
+
+// Узел уже снят с вершины. Если в этот момент идёт Snapshot, он мог начать обход раньше
+// и стоять на этом узле: тогда значение только копируется, а узел откладывается.
+// Снятие (CAS вершины) и чтение readers - seq_cst, как и в Snapshot, поэтому
+// либо здесь виден его readers, либо он уже прочитает вершину без этого узла
+template <class T>
+void ConcurrentStack<T>::TakeValue(Handle index, T& out) {
+    T* value = At(index).Value();
+    if (readers.load(std::memory_order_seq_cst) != 0) {
+        out = *value;
+        Retire(index, index);
+        return;
+    }
+    out = std::move(*value);
+    value->~T();
+    PushNode(freeList, index);
+}
+
+template <class T>
+bool ConcurrentStack<T>::TryPushNode(Handle index) {
+    Tagged head = top.load(std::memory_order_relaxed);
+    At(index).next.store(Index(head), std::memory_order_relaxed);
+    return top.compare_exchange_strong(head, Pack(index, head), std::memory_order_release,
+                                       std::memory_order_relaxed);
+}
+
+template <class T>
+typename ConcurrentStack<T>::Handle ConcurrentStack<T>::TryPopNode(bool& empty) {
+    Tagged head = top.load(std::memory_order_acquire);
+    empty = Index(head) == NIL;
+    if (empty) return NIL;
+    Handle next = At(Index(head)).next.load(std::memory_order_relaxed);
+    if (top.compare_exchange_strong(head, Pack(next, head), std::memory_order_seq_cst,
+                                    std::memory_order_relaxed)) {
+        return Index(head);
+    }
+    return NIL;
+}
+
+template <class T>
+Stack<T>* ConcurrentStack<T>::Snapshot() {
+    // Сначала readers, потом вершина: узлы, снятые после этого, TryPop уже не освободит
+    readers.fetch_add(1, std::memory_order_seq_cst);
+    Stack<T>* result = nullptr;
+    try {
+        DynamicArray<T> items(0);
+        items.Reserve(GetLength());
+        for (Handle index = Index(top.load(std::memory_order_seq_cst)); index != NIL;
+             index = At(index).next.load(std::memory_order_relaxed)) {
+            items.EmplaceBack(*At(index).Value());
+        }
+        std::reverse(items.begin(), items.end());
+        result = new Stack<T>();
+        result->PushMany(items.Data(), items.GetSize());
+    } catch (...) {
+        delete result;
+        EndRead();
+        throw;
+    }
+    EndRead();
+    return result;
+}
+
+// Кладёт цепочку first..last (по retiredNext) в список отложенных узлов
+template <class T>
+void ConcurrentStack<T>::Retire(Handle first, Handle last) {
+    Node& bottom = At(last);
+    Handle current = retired.load(std::memory_order_relaxed);
+    do {
+        bottom.retiredNext.store(current, std::memory_order_relaxed);
+    } while (!retired.compare_exchange_weak(current, first, std::memory_order_release,
+                                            std::memory_order_relaxed));
+}
+
+// Последний читатель забирает отложенные узлы. Если за это время начался новый Snapshot,
+// он может стоять на любом из них - тогда узлы возвращаются в retired до его конца
+template <class T>
+void ConcurrentStack<T>::EndRead() {
+    if (readers.fetch_sub(1, std::memory_order_seq_cst) != 1) return;
+
+    Handle first = retired.exchange(NIL, std::memory_order_seq_cst);
+    if (first == NIL) return;
+    if (readers.load(std::memory_order_seq_cst) != 0) {
+        Handle last = first;
+        for (Handle next = At(last).retiredNext.load(std::memory_order_relaxed); next != NIL;
+             next = At(last).retiredNext.load(std::memory_order_relaxed)) {
+            last = next;
+        }
+        Retire(first, last);
+        return;
+    }
+    while (first != NIL) {
+        Handle next = At(first).retiredNext.load(std::memory_order_relaxed);
+        At(first).Value()->~T();
+        PushNode(freeList, first);
+        first = next;
+    }
+}
+
+template <class T>
+Stack<T>* ConcurrentStack<T>::Map(T (*f)(T)) {
+    Stack<T>* snapshot = Snapshot();
+    Stack<T>* result = snapshot->Map(f);
+    delete snapshot;
+    return result;
+}
+
+template <class T>
+Stack<T>* ConcurrentStack<T>::Where(bool (*f)(T)) {
+    Stack<T>* snapshot = Snapshot();
+    Stack<T>* result = snapshot->Where(f);
+    delete snapshot;
+    return result;
+}
+
+template <class T>
+T ConcurrentStack<T>::Reduce(T (*f)(T, T), T initial) {
+    Stack<T>* snapshot = Snapshot();
+    T result = snapshot->Reduce(f, initial);
+    delete snapshot;
+    return result;
+}
+
+#endif
@@ -0,0 +1,254 @@
+#include "40_ConcurrentStack.h"
+#include "42_EliminationStack.h"
+#include <iostream>
+#include <fstream>
+#include <cassert>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <vector>
+
+void testConcurrentStack() {
+    std::ofstream outFile("outputConcurrent.txt");
+    if (!outFile) {
+        std::cerr << "Не удалось открыть файл outputConcurrent.txt для записи" << std::endl;
+        return;
+    }
+
+    outFile << "=== Starting ConcurrentStack tests ===" << std::endl;
+
+    // Тест 1: однопоточный LIFO
+    outFile << "\nTest 1: Single-threaded LIFO...";
+    {
+        ConcurrentStack<int> stack;
+        int value = 0;
+        bool popped = stack.TryPop(value);
+        assert(stack.IsEmpty() && !popped);
+        for (int i = 0; i < 1000; ++i) {
+            bool pushed = stack.TryPush(i);
+            assert(pushed);
+        }
+        assert(stack.GetLength() == 1000);
+        for (int i = 999; i >= 0; --i) {
+            popped = stack.TryPop(value);
+            assert(popped && value == i);
+        }
+        popped = stack.TryPop(value);
+        assert(stack.IsEmpty() && !popped);
+
+        // Узлы снятых элементов используются снова
+        ConcurrentStack<std::string> words;
+        words.TryPush("first");
+        words.TryPush(std::string(40, 'x'));
+        std::string word;
+        popped = words.TryPop(word);
+        assert(popped && word.size() == 40);
+        words.TryPush("third");
+        popped = words.TryPop(word);
+        assert(popped && word == "third");
+        popped = words.TryPop(word);
+        assert(popped && word == "first");
+    }
+    outFile << " ✓" << std::endl;
+
+    // Тест 2: снимки и функциональные операции
+    outFile << "\nTest 2: Snapshot / Map / Where / Reduce...";
+    {
+        ConcurrentStack<int> stack;
+        for (int i = 1; i <= 5; ++i) {
+            stack.TryPush(i);
+        }
+        Stack<int>* snapshot = stack.Snapshot();
+        assert(snapshot->GetLength() == 5 && snapshot->Peek() == 5);
+        delete snapshot;
+        assert(stack.GetLength() == 5);
+
+        Stack<int>* squares = stack.Map([](int x) { return x * x; });
+        assert(squares->Peek() == 25 && squares->GetLength() == 5);
+        delete squares;
+        Stack<int>* even = stack.Where([](int x) { return x % 2 == 0; });
+        assert(even->GetLength() == 2 && even->Peek() == 4);
+        delete even;
+        int total = stack.Reduce([](int x, int sum) { return x + sum; }, 0);
+        assert(total == 15);
+
+        int top = 0;
+        bool popped = stack.TryPop(top);
+        assert(popped && top == 5);
+
+        // Снимок читает стек на месте: снятие во время снимка не видит пустой стек,
+        // порядок LIFO не меняется, а каждый снимок - нижняя часть исходного стека
+        const int count = 3000;
+        ConcurrentStack<std::string> words;
+        for (int i = 0; i < count; ++i) {
+            words.TryPush(std::to_string(i));
+        }
+        std::atomic<bool> done(false);
+        std::atomic<int> badSnapshots(0);
+        std::thread reader([&words, &done, &badSnapshots]() {
+            while (!done.load()) {
+                Stack<std::string>* part = words.Snapshot();
+                for (int i = part->GetLength() - 1; i >= 0; --i) {
+                    if (part->Pop() != std::to_string(i)) {
+                        badSnapshots.fetch_add(1);
+                        break;
+                    }
+                }
+                delete part;
+            }
+        });
+        int ordered = 0;
+        std::string word;
+        for (int i = count - 1; i >= 0; --i) {
+            if (words.TryPop(word) && word == std::to_string(i)) ++ordered;
+        }
+        done.store(true);
+        reader.join();
+        assert(ordered == count && badSnapshots.load() == 0 && words.IsEmpty());
+        words.TryPush("reused");
+        popped = words.TryPop(word);
+        assert(popped && word == "reused");
+    }
+    outFile << " ✓" << std::endl;
+
+    // Тест 3: несколько потоков кладут и снимают - каждый элемент снят ровно один раз
+    outFile << "\nTest 3: Concurrent push/pop...";
+    {
+        const int threads = 4;
+        const int perThread = 20000;
+        ConcurrentStack<int> stack;
+        std::vector<std::vector<int>> taken(threads);
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back([&stack, &taken, t]() {
+                for (int i = 0; i < perThread; ++i) {
+                    stack.TryPush(t * perThread + i);
+                    int value;
+                    if (i % 3 != 0 && stack.TryPop(value)) {
+                        taken[t].push_back(value);
+                    }
+                }
+            });
+        }
+        // Снимки во время работы не теряют и не дублируют элементы
+        for (int s = 0; s < 20; ++s) {
+            delete stack.Snapshot();
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+        int value;
+        while (stack.TryPop(value)) {
+            taken[0].push_back(value);
+        }
+
+        std::vector<int> seen(threads * perThread, 0);
+        for (const std::vector<int>& values : taken) {
+            for (int item : values) {
+                ++seen[item];
+            }
+        }
+        for (int count : seen) {
+            assert(count == 1);
+        }
+        assert(stack.GetLength() == 0);
+    }
+    outFile << " ✓" << std::endl;
+
+    // Тест 4: стек с массивом исключения - те же гарантии, часть пар гасится в массиве
+    outFile << "\nTest 4: EliminationStack...";
+    {
+        EliminationStack<int> single(1, 1);
+        int value = 0;
+        single.TryPush(1);
+        single.TryPush(2);
+        bool first = single.TryPop(value) && value == 2;
+        bool second = single.TryPop(value) && value == 1;
+        bool third = single.TryPop(value);
+        assert(first && second && !third && single.IsEmpty());
+
+        const int threads = 8;
+        const int perThread = 10000;
+        EliminationStack<int> stack(4);
+        std::vector<std::vector<int>> taken(threads);
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back([&stack, &taken, t]() {
+                for (int i = 0; i < perThread; ++i) {
+                    stack.TryPush(t * perThread + i);
+                    int item;
+                    if (stack.TryPop(item)) {
+                        taken[t].push_back(item);
+                    }
+                }
+            });
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+        while (stack.TryPop(value)) {
+            taken[0].push_back(value);
+        }
+
+        std::vector<int> seen(threads * perThread, 0);
+        for (const std::vector<int>& values : taken) {
+            for (int item : values) {
+                ++seen[item];
+            }
+        }
+        for (int count : seen) {
+            assert(count == 1);
+        }
+        outFile << " eliminated " << stack.GetEliminated();
+    }
+    outFile << " ✓" << std::endl;
+
+    // Тест 5: один поток только кладёт, другой только снимает, третий читает длину и снимки.
+    // Длина не уходит ниже нуля, снимок не бросает; EliminationStack - через ConcurrentStack<T>&
+    outFile << "\nTest 5: Length stays non-negative under push-only / pop-only...";
+    {
+        ConcurrentStack<int> plain;
+        EliminationStack<int> eliminating(2, 4);
+        ConcurrentStack<int>* stacks[] = {&plain, &eliminating};
+        for (ConcurrentStack<int>* stack : stacks) {
+            const int pushes = 200000;
+            std::atomic<bool> done(false);
+            std::atomic<int> negative(0);
+            std::atomic<int> failedSnapshots(0);
+            std::thread pusher([stack]() {
+                for (int i = 0; i < pushes; ++i) {
+                    stack->TryPush(i);
+                }
+            });
+            std::thread popper([stack, &done]() {
+                int value;
+                while (!done.load()) {
+                    stack->TryPop(value);
+                }
+            });
+            std::thread reader([stack, &done, &negative, &failedSnapshots]() {
+                while (!done.load()) {
+                    if (stack->GetLength() < 0) negative.fetch_add(1);
+                    try {
+                        delete stack->Snapshot();
+                    } catch (...) {
+                        failedSnapshots.fetch_add(1);
+                    }
+                }
+            });
+            pusher.join();
+            done.store(true);
+            popper.join();
+            reader.join();
+            int value;
+            while (stack->TryPop(value)) {}
+            assert(negative.load() == 0 && failedSnapshots.load() == 0 && stack->GetLength() == 0);
+        }
+    }
+    outFile << " ✓" << std::endl;
+
+    outFile << "\n=== All ConcurrentStack tests passed successfully! ===" << std::endl;
+
+    outFile.close();
+    std::cout << "Тесты завершены. Результаты записаны в outputConcurrent.txt" << std::endl;
+}
@@ -0,0 +1,155 @@
+#ifndef ELIMINATION_STACK_H
+#define ELIMINATION_STACK_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "40_ConcurrentStack.h"
+
+// ConcurrentStack с массивом исключения (elimination-backoff). Поток, проигравший CAS
+// на вершине, не повторяет его сразу, а идёт в случайную ячейку массива: Push оставляет
+// там свой узел и ждёт, Pop забирает узел, оставленный в ячейке. Встретившиеся пары
+// Push/Pop гасят друг друга, не трогая вершину; не дождавшийся поток возвращается к CAS.
+//   width    - число ячеек; чем больше потоков, тем больше нужно ячеек
+//   patience - сколько раз Push проверяет ячейку, прежде чем забрать узел обратно
+template <class T>
+class EliminationStack : public ConcurrentStack<T> {
+public:
+    explicit EliminationStack(int width = 8, int patience = 16);
+
+    bool TryPush(T item) override;
+    bool TryPop(T& out) override;
+
+    // Сколько пар Push/Pop встретились в массиве
+    long long GetEliminated() const { return eliminated.load(std::memory_order_relaxed); }
+
+private:
+    typedef typename ConcurrentStack<T>::Handle Handle;
+    typedef typename ConcurrentStack<T>::Tagged Tagged;
+
+    // Ячейка: [метка:30][состояние:2][индекс узла:32], метка меняется при каждой записи
+    enum SlotState { EMPTY = 0, WAITING = 1, TAKEN = 2 };
+
+    int patience;
+    std::vector<std::atomic<Tagged>> slots;
+    std::atomic<long long> eliminated;
+
+    static SlotState State(Tagged word) { return static_cast<SlotState>((word >> 32) & 3); }
+    static Tagged Make(SlotState state, Handle index, Tagged previous) {
+        return ((((previous >> 34) + 1) << 34)) | (Tagged(state) << 32) | index;
+    }
+
+    std::atomic<Tagged>& RandomSlot();
+    bool OfferNode(Handle index);
+    Handle TakeNode();
+};
+
+template <class T>
+EliminationStack<T>::EliminationStack(int width, int patience) : patience(patience), slots(width), eliminated(0) {
+    if (width <= 0 || patience <= 0) {
+        throw std::invalid_argument("Elimination array width and patience must be positive");
+    }
+    for (std::atomic<Tagged>& slot : slots) {
+        slot.store(Make(EMPTY, ConcurrentStack<T>::NIL, 0), std::memory_order_relaxed);
+    }
+}
+
+// У каждого потока свой генератор xorshift: общий генератор сам стал бы точкой соперничества
+template <class T>
+std::atomic<typename EliminationStack<T>::Tagged>& EliminationStack<T>::RandomSlot() {
+    thread_local std::uint32_t state =
+        static_cast<std::uint32_t>(std::hash<std::thread::id>()(std::this_thread::get_id())) | 1u;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return slots[state % slots.size()];
+}
+
+// true - узел забрал Pop; false - никто не пришёл, узел снова у вызывающего
+template <class T>
+bool EliminationStack<T>::OfferNode(Handle index) {
+    std::atomic<Tagged>& slot = RandomSlot();
+    Tagged word = slot.load(std::memory_order_relaxed);
+    if (State(word) != EMPTY) return false;
+    Tagged offer = Make(WAITING, index, word);
+    if (!slot.compare_exchange_strong(word, offer, std::memory_order_release, std::memory_order_relaxed)) {
+        return false;
+    }
+
+    for (int attempt = 0; attempt < patience; ++attempt) {
+        Tagged current = slot.load(std::memory_order_acquire);
+        if (current != offer) {
+            // Ячейку перевёл в TAKEN только Pop; освобождает её тот, кто её занял
+            slot.store(Make(EMPTY, ConcurrentStack<T>::NIL, current), std::memory_order_relaxed);
+            return true;
+        }
+        std::this_thread::yield();
+    }
+    if (slot.compare_exchange_strong(offer, Make(EMPTY, ConcurrentStack<T>::NIL, offer), std::memory_order_relaxed)) {
+        return false;
+    }
+    slot.store(Make(EMPTY, ConcurrentStack<T>::NIL, offer), std::memory_order_relaxed);
+    return true;
+}
+
+template <class T>
+typename EliminationStack<T>::Handle EliminationStack<T>::TakeNode() {
+    std::atomic<Tagged>& slot = RandomSlot();
+    Tagged word = slot.load(std::memory_order_acquire);
+    if (State(word) != WAITING) return ConcurrentStack<T>::NIL;
+    Handle index = static_cast<Handle>(word);
+    if (slot.compare_exchange_strong(word, Make(TAKEN, index, word), std::memory_order_acquire,
+                                     std::memory_order_relaxed)) {
+        return index;
+    }
+    return ConcurrentStack<T>::NIL;
+}
+
+template <class T>
+bool EliminationStack<T>::TryPush(T item) {
+    Handle index = this->AllocateNode();
+    if (index == ConcurrentStack<T>::NIL) return false;
+    try {
+        new (this->At(index).Value()) T(std::move(item));
+    } catch (...) {
+        this->PushNode(this->freeList, index);
+        throw;
+    }
+    // Счётчик - до публикации узла, как в ConcurrentStack::TryPush; узел, отданный
+    // через массив исключения, в стек не попал, и счётчик возвращается назад
+    this->length.fetch_add(1, std::memory_order_relaxed);
+    while (true) {
+        if (this->TryPushNode(index)) {
+            return true;
+        }
+        if (OfferNode(index)) {
+            this->length.fetch_sub(1, std::memory_order_relaxed);
+            eliminated.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+}
+
+template <class T>
+bool EliminationStack<T>::TryPop(T& out) {
+    while (true) {
+        bool empty = false;
+        Handle index = this->TryPopNode(empty);
+        if (index != ConcurrentStack<T>::NIL) {
+            this->length.fetch_sub(1, std::memory_order_relaxed);
+            this->TakeValue(index, out);
+            return true;
+        }
+        if (empty) return false;
+        index = TakeNode();
+        if (index != ConcurrentStack<T>::NIL) {
+            this->TakeValue(index, out);
+            return true;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,148 @@
+#ifndef STACK_PIPELINE_H
+#define STACK_PIPELINE_H
+
+#include <type_traits>
+#include <utility>
+#include "3_DynamicArray.h"
+
+template <class T> class Stack;
+
+// Ленивая цепочка Map/Where над элементами стека (от дна к вершине).
+// Map и Where только запоминают функцию; Reduce и ToStack проходят по элементам
+// один раз, пропуская каждый через все стадии, без промежуточных контейнеров.
+// Функции - любые вызываемые объекты (лямбды, функторы, указатели), тип стадии
+// известен компилятору, поэтому вызовы встраиваются.
+// Цепочка ссылается на элементы стека: стек должен жить и не меняться, пока она используется.
+
+// Источник: обход смежного диапазона
+template <class T> struct RangeStage
+    {
+        typedef T Value;
+        // Число элементов на выходе стадии известно заранее
+        static const bool EXACT = true;
+        const T* first;
+        const T* last;
+
+        int Size() const { return static_cast<int>(last - first); }
+
+        template <class Sink> void Run(Sink& sink) const {
+            for (const T* item = first; item != last; ++item) {
+                sink(*item);
+            }
+        }
+    };
+
+template <class Inner, class F> struct MapStage
+    {
+        typedef typename std::decay<decltype(std::declval<const F&>()(std::declval<const typename Inner::Value&>()))>::type Value;
+        static const bool EXACT = Inner::EXACT;
+        Inner inner;
+        F f;
+
+        int Size() const { return inner.Size(); }
+
+        template <class Sink> struct MapSink
+            {
+                Sink& sink;
+                const F& f;
+                template <class X> void operator()(const X& item) { sink(f(item)); }
+            };
+
+        template <class Sink> void Run(Sink& sink) const {
+            MapSink<Sink> mapped = { sink, f };
+            inner.Run(mapped);
+        }
+    };
+
+template <class Inner, class P> struct WhereStage
+    {
+        typedef typename Inner::Value Value;
+        static const bool EXACT = false;
+        Inner inner;
+        P predicate;
+
+        int Size() const { return inner.Size(); }
+
+        template <class Sink> struct WhereSink
+            {
+                Sink& sink;
+                const P& predicate;
+                template <class X> void operator()(const X& item) {
+                    if (predicate(item)) sink(item);
+                }
+            };
+
+        template <class Sink> void Run(Sink& sink) const {
+            WhereSink<Sink> filtered = { sink, predicate };
+            inner.Run(filtered);
+        }
+    };
+
+template <class T> const bool RangeStage<T>::EXACT;
+template <class Inner, class F> const bool MapStage<Inner, F>::EXACT;
+template <class Inner, class P> const bool WhereStage<Inner, P>::EXACT;
+
+template <class Stage> class StackPipeline
+    {
+        public:
+            typedef typename Stage::Value Value;
+
+            explicit StackPipeline(const Stage& stage) : stage(stage) {}
+
+            template <class F> StackPipeline<MapStage<Stage, F>> Map(F f) const {
+                return StackPipeline<MapStage<Stage, F>>(MapStage<Stage, F>{ stage, f });
+            }
+
+            template <class P> StackPipeline<WhereStage<Stage, P>> Where(P predicate) const {
+                return StackPipeline<WhereStage<Stage, P>>(WhereStage<Stage, P>{ stage, predicate });
+            }
+
+            // Как Stack::Reduce: result = f(item, result) от дна к вершине
+            template <class F, class A> A Reduce(F f, A initial) const {
+                ReduceSink<F, A> sink = { f, std::move(initial) };
+                stage.Run(sink);
+                return std::move(sink.result);
+            }
+
+            // Новый стек из элементов, прошедших цепочку. Без Where длина известна
+            // и буфер выделяется один раз, с Where - растёт геометрически
+            Stack<Value>* ToStack() const {
+                DynamicArray<Value> values(0);
+                if (Stage::EXACT) values.Reserve(stage.Size());
+                CollectSink sink = { values };
+                stage.Run(sink);
+                return new Stack<Value>(std::move(values));
+            }
+
+            // Сколько элементов дойдёт до конца цепочки
+            int Count() const {
+                if (Stage::EXACT) return stage.Size();
+                CountSink sink = { 0 };
+                stage.Run(sink);
+                return sink.count;
+            }
+
+        private:
+            Stage stage;
+
+            template <class F, class A> struct ReduceSink
+                {
+                    F f;
+                    A result;
+                    template <class X> void operator()(const X& item) { result = f(item, result); }
+                };
+
+            struct CollectSink
+                {
+                    DynamicArray<Value>& values;
+                    template <class X> void operator()(X&& item) { values.EmplaceBack(std::forward<X>(item)); }
+                };
+
+            struct CountSink
+                {
+                    int count;
+                    template <class X> void operator()(const X&) { ++count; }
+                };
+    };
+
+#endif
@@ -0,0 +1,116 @@
+#ifndef PARALLEL_CHUNKS_H
+#define PARALLEL_CHUNKS_H
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Параллельный проход по индексам [0, count) для Map/Where/Reduce контейнеров.
+// Диапазон режется на куски по grain элементов; потоки берут куски по очереди из общего
+// счётчика, поэтому дорогие куски не задерживают остальные. Результат куска k хранится
+// в ячейке k, и вызывающий собирает их слева направо - порядок элементов сохраняется.
+// Потоки запускаются на время прохода, как в BatchEvaluator: кусок должен работать
+// заметно дольше, чем стоит запуск потока (десятки микросекунд).
+
+// Элементов в куске по умолчанию
+const int PARALLEL_GRAIN = 1 << 14;
+
+inline int ParallelChunkCount(int count, int grain) {
+    if (grain <= 0) {
+        throw std::invalid_argument("Grain size must be positive");
+    }
+    return static_cast<int>((static_cast<long long>(count) + grain - 1) / grain);
+}
+
+// body(chunk, begin, end) для каждого куска; threads - сколько потоков, 0 - по числу ядер.
+// Первое исключение из body пробрасывается, когда все потоки завершились
+template <class Body>
+void ParallelChunks(int count, int grain, int threads, const Body& body) {
+    int chunks = ParallelChunkCount(count, grain);
+    if (threads <= 0) {
+        threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+    threads = std::min(threads, chunks);
+    auto bounds = [count, grain](int chunk) {
+        long long begin = static_cast<long long>(chunk) * grain;
+        return std::make_pair(static_cast<int>(begin), static_cast<int>(std::min<long long>(count, begin + grain)));
+    };
+    if (threads <= 1) {
+        for (int chunk = 0; chunk < chunks; ++chunk) {
+            std::pair<int, int> range = bounds(chunk);
+            body(chunk, range.first, range.second);
+        }
+        return;
+    }
+
+    std::atomic<int> next(0);
+    std::atomic<bool> failed(false);
+    std::exception_ptr error;
+    auto work = [&]() {
+        try {
+            for (int chunk = next.fetch_add(1, std::memory_order_relaxed);
+                 chunk < chunks && !failed.load(std::memory_order_relaxed);
+                 chunk = next.fetch_add(1, std::memory_order_relaxed)) {
+                std::pair<int, int> range = bounds(chunk);
+                body(chunk, range.first, range.second);
+            }
+        } catch (...) {
+            if (!failed.exchange(true)) {
+                error = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    try {
+        workers.reserve(threads - 1);
+        for (int t = 1; t < threads; ++t) {
+            workers.emplace_back(work);
+        }
+    } catch (...) {
+        // Не удалось запустить поток - оставшиеся куски доделают уже запущенные
+    }
+    work();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+// Каждый кусок заполняет свой буфер: fill(part, begin, end). Буферы идут в порядке кусков
+template <class U, class Fill>
+std::vector<std::vector<U>> ParallelCollect(int count, int grain, int threads, const Fill& fill) {
+    std::vector<std::vector<U>> parts(ParallelChunkCount(count, grain));
+    ParallelChunks(count, grain, threads, [&parts, &fill](int chunk, int begin, int end) {
+        fill(parts[chunk], begin, end);
+    });
+    return parts;
+}
+
+// fold(begin, end) - свёртка одного куска; combine(result, part) присоединяет куски
+// слева направо к initial
+template <class A, class Fold, class Combine>
+A ParallelFold(int count, int grain, int threads, A initial, const Fold& fold, const Combine& combine) {
+    // Обёртка нужна, чтобы std::vector<bool> не упаковал соседние куски в одно слово
+    struct Slot
+        {
+            A value;
+        };
+    std::vector<Slot> partials(ParallelChunkCount(count, grain), Slot{ initial });
+    ParallelChunks(count, grain, threads, [&partials, &fold](int chunk, int begin, int end) {
+        partials[chunk].value = fold(begin, end);
+    });
+    A result = std::move(initial);
+    for (Slot& partial : partials) {
+        result = combine(std::move(result), partial.value);
+    }
+    return result;
+}
+
+#endif
@@ -4,13 +4,18 @@
 #include <stdexcept>
 #include <sstream>
 #include <string>
+#include <type_traits>
+#include <iterator>
+#include <cstddef>
+#include "19_MemoryResource.h"
 
 template <class T> class LinkedList
     {
         public:
-            LinkedList();
-            LinkedList(T* items, int count);
+            explicit LinkedList(MemoryResource* resource = DefaultResource());
+            LinkedList(T* items, int count, MemoryResource* resource = DefaultResource());
             LinkedList(const LinkedList <T> & list);
+            LinkedList(const LinkedList <T> & list, MemoryResource* resource);
             
             ~LinkedList();
 
@@ -23,9 +28,11 @@ template <class T> class LinkedList
             void Append(T item);
             void Prepend(T item);
             void InsertAt(T item, int index);
+            template <class InputIt> void InsertRange(int index, InputIt first, InputIt last);
             LinkedList<T>* Concat(LinkedList<T>* list) const;
             LinkedList& operator= (const LinkedList<T>& list);
             std::string ToString() const;
+            MemoryResource* GetResource() const;
             
         private:
             struct Node
@@ -35,22 +42,74 @@ template <class T> class LinkedList
                     Node(T data) : data(data), next(nullptr) {}
                 };
         
+        public:
+            // Прямой итератор по узлам: обход целиком - O(n) без поиска по индексу
+            template <class Ref, class NodePtr> class BasicIterator
+                {
+                    public:
+                        typedef std::forward_iterator_tag iterator_category;
+                        typedef T value_type;
+                        typedef std::ptrdiff_t difference_type;
+                        typedef typename std::remove_reference<Ref>::type* pointer;
+                        typedef Ref reference;
+
+                        explicit BasicIterator(NodePtr node = nullptr) : node(node) {}
+                        // Iterator -> ConstIterator
+                        template <class R, class N> BasicIterator(const BasicIterator<R, N>& other) : node(other.node) {}
+
+                        Ref operator*() const { return node->data; }
+                        pointer operator->() const { return &node->data; }
+                        BasicIterator& operator++() { node = node->next; return *this; }
+                        BasicIterator operator++(int) { BasicIterator old = *this; node = node->next; return old; }
+                        template <class R, class N> bool operator==(const BasicIterator<R, N>& other) const { return node == other.node; }
+                        template <class R, class N> bool operator!=(const BasicIterator<R, N>& other) const { return node != other.node; }
+
+                    private:
+                        template <class R, class N> friend class BasicIterator;
+                        NodePtr node;
+                };
+
+            typedef BasicIterator<T&, Node*> Iterator;
+            typedef BasicIterator<const T&, const Node*> ConstIterator;
+
+            Iterator begin() { return Iterator(head); }
+            Iterator end() { return Iterator(); }
+            ConstIterator begin() const { return ConstIterator(head); }
+            ConstIterator end() const { return ConstIterator(); }
+
+        private:
             Node* head;
             Node* tail;
             int size;
+            MemoryResource* resource;
+            // Узлы списка берутся из собственного пула: освобождённые узлы уходят
+            // в список свободных и переиспользуются, соседние узлы лежат рядом в памяти
+            NodePool pool;
+            // Последний найденный по индексу узел: следующий Get(i + k) идёт от него,
+            // поэтому последовательный обход по индексам - O(1) на элемент.
+            // Кэш меняется и в const-методах, одновременное чтение из нескольких потоков не поддерживается
+            mutable Node* finger;
+            mutable int fingerIndex;
+
+            Node* NodeAt(int index) const;
+            void Clear();
     };
 
 ////////////////////////////////////////////////////////////////////////////
 
-template <class T> LinkedList<T>::LinkedList() : head(nullptr), tail(nullptr), size(0) {}
+template <class T> LinkedList<T>::LinkedList(MemoryResource* resource)
+    : head(nullptr), tail(nullptr), size(0), resource(resource), pool(sizeof(Node), 8, resource, 512),
+      finger(nullptr), fingerIndex(0) {}
 
-template <class T> LinkedList<T>::LinkedList(T* items, int count) : LinkedList() {
+template <class T> LinkedList<T>::LinkedList(T* items, int count, MemoryResource* resource) : LinkedList(resource) {
     for (int i = 0; i < count; ++i) {
         Append(items[i]);
     }
 }
 
-template <class T> LinkedList<T>::LinkedList(const LinkedList<T>& list) : LinkedList() {
+template <class T> LinkedList<T>::LinkedList(const LinkedList<T>& list) : LinkedList(list, list.resource) {}
+
+template <class T> LinkedList<T>::LinkedList(const LinkedList<T>& list, MemoryResource* resource) : LinkedList(resource) {
     Node* current = list.head;
     while (current != nullptr) {
         Append(current->data);
@@ -59,11 +118,22 @@ template <class T> LinkedList<T>::LinkedList(const LinkedList<T>& list) : Linked
 }
 
 template <class T> LinkedList<T>::~LinkedList() {
+    // Для тривиально разрушаемых T обход не нужен: пул вернёт все пачки целиком
+    if (!std::is_trivially_destructible<T>::value) {
+        Clear();
+    }
+}
+
+template <class T> void LinkedList<T>::Clear() {
     while (head != nullptr) {
         Node* temp = head;
         head = head->next;
-        delete temp;
+        DeleteObject(&pool, temp);
     }
+    tail = nullptr;
+    size = 0;
+    finger = nullptr;
+    fingerIndex = 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////
@@ -82,16 +152,32 @@ template <class T> T LinkedList<T>::GetLast() const{
     return tail->data;
 }
 
-template <class T> T LinkedList<T>::Get(int index) const{
-    if (index < 0 || index >= size) {
-        throw std::out_of_range("Index out of range");
+template <class T> typename LinkedList<T>::Node* LinkedList<T>::NodeAt(int index) const{
+    if (index == size - 1) {
+        return tail;
     }
 
     Node* current = head;
-    for (int i = 0; i < index; ++i) {
+    int position = 0;
+    if (finger != nullptr && fingerIndex <= index) {
+        current = finger;
+        position = fingerIndex;
+    }
+    for (; position < index; ++position) {
         current = current->next;
     }
-    return current->data;
+
+    finger = current;
+    fingerIndex = index;
+    return current;
+}
+
+template <class T> T LinkedList<T>::Get(int index) const{
+    if (index < 0 || index >= size) {
+        throw std::out_of_range("Index out of range");
+    }
+
+    return NodeAt(index)->data;
 }
 
 template <class T> LinkedList<T>* LinkedList<T>::GetSubList(int startIndex, int endIndex) const{
@@ -99,11 +185,8 @@ template <class T> LinkedList<T>* LinkedList<T>::GetSubList(int startIndex, int
         throw std::out_of_range("Invalid index range");
     }
 
-    LinkedList<T>* subList = new LinkedList<T>();
-    Node* current = head;
-    for (int i = 0; i < startIndex; ++i) {
-        current = current->next;
-    }
+    LinkedList<T>* subList = new LinkedList<T>(resource);
+    Node* current = NodeAt(startIndex);
     for (int i = startIndex; i <= endIndex; ++i) {
         subList->Append(current->data);
         current = current->next;
@@ -115,10 +198,14 @@ template <class T> int LinkedList<T>::GetLength() const{
     return size;
 }
 
+template <class T> MemoryResource* LinkedList<T>::GetResource() const{
+    return resource;
+}
+
 ////////////////////////////////////////////////////////////////////////////
 
 template <class T> void LinkedList<T>::Append(T item) {
-    Node* newNode = new Node(item);
+    Node* newNode = NewObject<Node>(&pool, item);
     if (tail == nullptr) {
         head = tail = newNode;
     }
@@ -130,7 +217,7 @@ template <class T> void LinkedList<T>::Append(T item) {
 }
 
 template <class T> void LinkedList<T>::Prepend(T item) {
-    Node* newNode = new Node(item);
+    Node* newNode = NewObject<Node>(&pool, item);
     if (head == nullptr) {
         head = tail = newNode;
     }
@@ -139,6 +226,7 @@ template <class T> void LinkedList<T>::Prepend(T item) {
         head = newNode;
     }
     size++;
+    fingerIndex++;
 }
 
 template <class T> void LinkedList<T>::InsertAt(T item, int index) {
@@ -153,17 +241,59 @@ template <class T> void LinkedList<T>::InsertAt(T item, int index) {
         Append(item);
     }
     else {
-        Node* newNode = new Node(item);
-        Node* prev = head;
-        for (int i = 0; i < index - 1; ++i) {
-            prev = prev->next;
-        }
+        Node* prev = NodeAt(index - 1);
+        Node* newNode = NewObject<Node>(&pool, item);
         newNode->next = prev->next;
         prev->next = newNode;
         size++;
     }
 }
 
+// Элементы диапазона сначала собираются в отдельную цепочку, затем она целиком
+// вставляется после узла index - 1: один поиск по индексу на всю вставку.
+// Пока цепочка строится, список не меняется, поэтому исключение его не портит
+template <class T> template <class InputIt> void LinkedList<T>::InsertRange(int index, InputIt first, InputIt last) {
+    if (index < 0 || index > size) {
+        throw std::out_of_range("Index out of range");
+    }
+
+    Node* chainHead = nullptr;
+    Node* chainTail = nullptr;
+    int count = 0;
+    try {
+        for (; first != last; ++first, ++count) {
+            Node* newNode = NewObject<Node>(&pool, *first);
+            if (chainHead == nullptr) chainHead = newNode;
+            else chainTail->next = newNode;
+            chainTail = newNode;
+        }
+    } catch (...) {
+        while (chainHead != nullptr) {
+            Node* temp = chainHead;
+            chainHead = chainHead->next;
+            DeleteObject(&pool, temp);
+        }
+        throw;
+    }
+    if (count == 0) {
+        return;
+    }
+
+    if (index == 0) {
+        chainTail->next = head;
+        head = chainHead;
+        if (tail == nullptr) tail = chainTail;
+        fingerIndex += count;
+    }
+    else {
+        Node* prev = NodeAt(index - 1);
+        chainTail->next = prev->next;
+        prev->next = chainHead;
+        if (prev == tail) tail = chainTail;
+    }
+    size += count;
+}
+
 template <class T> LinkedList<T>* LinkedList<T>::Concat(LinkedList<T>* list) const{
     if (list == nullptr) {
         throw std::invalid_argument("List cannot be null");
@@ -180,13 +310,7 @@ template <class T> LinkedList<T>* LinkedList<T>::Concat(LinkedList<T>* list) con
 
 template <class T> LinkedList<T>& LinkedList<T>::operator=(const LinkedList<T>& list) {
     if (this != &list) {
-        while (head != nullptr) {
-            Node* temp = head;
-            head = head->next;
-            delete temp;
-        }
-        tail = nullptr;
-        size = 0;
+        Clear();
 
         Node* current = list.head;
         while (current != nullptr) {
@@ -5,44 +5,65 @@
 #include <sstream>
 #include <vector>
 #include "1_ArraySequence.h"
+#include "35_SimdKernels.h"
+#include "36_BatchEvaluation.h"
+#include "37_FormExpressions.h"
 
 template <class T>
-class LinearForm {
+class LinearForm : public FormExpression<T, LinearForm<T>> {
 public:
     // Конструкторы
-    LinearForm(T* items, int count) {
-        coefficients = new MutableArraySequence<T>(items, count);
+    // upstream - откуда брать память, если коэффициенты не помещаются в саму форму
+    LinearForm(T* items, int count, MemoryResource* upstream = DefaultResource()) : storage(upstream), coefficients(&storage) {
+        coefficients.AppendRange(items, items + count);
     }
     
-    LinearForm() {
-        coefficients = new MutableArraySequence<T>();
-    }
+    LinearForm() : storage(), coefficients(&storage) {}
+
+    explicit LinearForm(MemoryResource* upstream) : storage(upstream), coefficients(&storage) {}
     
-    LinearForm(const LinearForm<T>& other) {
-        coefficients = other.coefficients->Clone();
+    LinearForm(const LinearForm<T>& other) : storage(), coefficients(&storage) {
+        coefficients.AppendRange(other.coefficients.begin(), other.coefficients.end());
     }
-    
-    ~LinearForm() {
-        delete coefficients;
+
+    // Сначала отпускаем свой буфер, чтобы копия снова легла в storage
+    LinearForm& operator=(const LinearForm<T>& other) {
+        if (this != &other) {
+            coefficients = MutableArraySequence<T>(&storage);
+            coefficients.AppendRange(other.coefficients.begin(), other.coefficients.end());
+        }
+        return *this;
+    }
+
+    // Результат ленивого выражения над формами (37_FormExpressions.h): один проход, один буфер
+    template <class E> LinearForm(const FormExpression<T, E>& expression) : storage(), coefficients(&storage) {
+        Materialize(expression.Self());
+    }
+
+    // Выражение может ссылаться на саму форму, поэтому старые коэффициенты отпускаются
+    // только после того, как посчитаны новые
+    template <class E> LinearForm& operator=(const FormExpression<T, E>& expression) {
+        Materialize(expression.Self());
+        return *this;
     }
 
     // Основные методы доступа
     T GetFirst() const { 
         if (GetLength() == 0) throw std::out_of_range("Form is empty");
-        return coefficients->GetFirst(); 
+        return coefficients.GetFirst(); 
     }
     
     T GetLast() const { 
         if (GetLength() == 0) throw std::out_of_range("Form is empty");
-        return coefficients->GetLast(); 
+        return coefficients.GetLast(); 
     }
     
     T Get(int index) const { 
-        return coefficients->Get(index); 
+        return coefficients.Get(index); 
     }
     
     int GetLength() const { 
-        return coefficients->GetLength(); 
+        return coefficients.GetLength(); 
     }
     
     std::string ToString() const;
@@ -55,18 +76,68 @@ public:
 
     // Вычисление значений
     T Evaluate(const ArraySequence<T>& variables) const;
+    // Многочлен c0 + c1*x + c2*x^2 + ... по схеме Горнера
     T Evaluate(T x) const;
+    // Тот же многочлен по схеме Эстрина: блоки по 8 коэффициентов считаются независимо
+    // друг от друга, что выгоднее Горнера на высоких степенях. Порядок округлений другой
+    T EvaluateEstrin(T x) const;
+    // Многочлен в count точках xs, векторно по нескольку точек за раз
+    ArraySequence<T>* EvaluateMany(const T* xs, int count) const;
+    // Значения формы на count точках по GetLength() - 1 координат (см. 36_BatchEvaluation.h).
+    // threads - число потоков, 0 - по числу ядер
+    ArraySequence<T>* EvaluateBatch(const T* points, int count, MatrixLayout layout, int threads = 1) const;
+    // Значения formCount форм одной длины: элемент p * formCount + f - форма f на точке p
+    static ArraySequence<T>* EvaluateBatch(const LinearForm<T>* forms, int formCount, const T* points, int count,
+                                           MatrixLayout layout, int threads = 1);
     ArraySequence<T>* Gradient() const;
     T PartialDerivative(int variableIndex) const;
 
-    // Операторы
-    LinearForm<T>* operator+(const LinearForm<T>& other) const { return Add(other); }
-    LinearForm<T>* operator-(const LinearForm<T>& other) const { return Subtract(other); }
-    LinearForm<T>* operator*(const T& scalar) const { return Multiply(scalar); }
-    LinearForm<T>* operator/(const T& scalar) const { return Divide(scalar); }
+    // Лист выражения над коэффициентами формы; операторы +, -, *, / строят выражения
+    FormTerm<T> Term() const { return FormTerm<T>(coefficients.begin(), GetLength()); }
 
 private:
-    ArraySequence<T>* coefficients;
+    // Коэффициенты небольшой формы лежат в ней самой: буфер массива берётся из storage,
+    // и форма не обращается к куче. storage объявлен раньше - он должен пережить массив
+    static const int INLINE_COEFFICIENTS = 8;
+    InlineResource<DynamicArray<T>::BytesFor(INLINE_COEFFICIENTS)> storage;
+    MutableArraySequence<T> coefficients;
+
+    // Новая форма той же длины; kernel заполняет её буфер напрямую, без промежуточного массива
+    template <class Kernel> LinearForm<T>* Combine(Kernel kernel) const {
+        LinearForm<T>* result = new LinearForm<T>();
+        try {
+            DynamicArray<T> values(GetLength(), &result->storage);
+            kernel(values.Data());
+            result->coefficients = MutableArraySequence<T>(std::move(values));
+        } catch (...) {
+            delete result;
+            throw;
+        }
+        return result;
+    }
+
+    // Небольшой результат считается во временный буфер на стеке: storage ещё занят старыми
+    // коэффициентами, а выделение из него сейчас ушло бы в кучу. Затем, как в operator=,
+    // старый буфер отпускается, и результат копируется в storage
+    template <class E> void Materialize(const E& expression) {
+        int length = expression.GetLength();
+        if (length <= INLINE_COEFFICIENTS) {
+            T buffer[INLINE_COEFFICIENTS];
+            for (int i = 0; i < length; ++i) {
+                buffer[i] = expression.Get(i);
+            }
+            coefficients = MutableArraySequence<T>(&storage);
+            coefficients.AppendRange(buffer, buffer + length);
+            return;
+        }
+
+        DynamicArray<T> values(length, &storage);
+        T* out = values.Data();
+        for (int i = 0; i < length; ++i) {
+            out[i] = expression.Get(i);
+        }
+        coefficients = MutableArraySequence<T>(std::move(values));
+    }
 
     void CheckDimensions(const LinearForm<T>& other) const {
         if (GetLength() != other.GetLength()) {
@@ -75,6 +146,12 @@ private:
     }
 };
 
+template <class T> struct FormOperand<LinearForm<T>>
+    {
+        typedef FormTerm<T> Type;
+        static Type Wrap(const LinearForm<T>& form) { return form.Term(); }
+    };
+
 // Реализации методов
 template <class T> 
 std::string LinearForm<T>::ToString() const {
@@ -94,13 +171,9 @@ LinearForm<T>* LinearForm<T>::Add(const LinearForm<T>& other) const {
     if (GetLength() == 0) return new LinearForm<T>();
     
     try {
-        T* new_coeffs = new T[GetLength()];
-        for (int i = 0; i < GetLength(); ++i) {
-            new_coeffs[i] = Get(i) + other.Get(i);
-        }
-        LinearForm<T>* result = new LinearForm<T>(new_coeffs, GetLength());
-        delete[] new_coeffs;
-        return result;
+        const T* left = coefficients.begin();
+        const T* right = other.coefficients.begin();
+        return Combine([&](T* out) { SimdKernels<T>::Add(left, right, out, GetLength()); });
     } catch (...) {
         throw std::runtime_error("Memory allocation failed in Add operation");
     }
@@ -109,24 +182,15 @@ LinearForm<T>* LinearForm<T>::Add(const LinearForm<T>& other) const {
 template <class T> 
 LinearForm<T>* LinearForm<T>::Subtract(const LinearForm<T>& other) const {
     CheckDimensions(other);
-    T* new_coeffs = new T[GetLength()];
-    for (int i = 0; i < GetLength(); ++i) {
-        new_coeffs[i] = Get(i) - other.Get(i);
-    }
-    LinearForm<T>* result = new LinearForm<T>(new_coeffs, GetLength());
-    delete[] new_coeffs;
-    return result;
+    const T* left = coefficients.begin();
+    const T* right = other.coefficients.begin();
+    return Combine([&](T* out) { SimdKernels<T>::Sub(left, right, out, GetLength()); });
 }
 
 template <class T> 
 LinearForm<T>* LinearForm<T>::Multiply(const T& scalar) const {
-    T* new_coeffs = new T[GetLength()];
-    for (int i = 0; i < GetLength(); ++i) {
-        new_coeffs[i] = Get(i) * scalar;
-    }
-    LinearForm<T>* result = new LinearForm<T>(new_coeffs, GetLength());
-    delete[] new_coeffs;
-    return result;
+    const T* source = coefficients.begin();
+    return Combine([&](T* out) { SimdKernels<T>::Scale(source, scalar, out, GetLength()); });
 }
 
 template <class T> 
@@ -143,38 +207,100 @@ T LinearForm<T>::Evaluate(const ArraySequence<T>& variables) const {
         throw std::invalid_argument("Number of variables doesn't match form dimension");
     }
 
-    T result = Get(0); 
-    for (int i = 1; i < GetLength(); ++i) {
-        result += Get(i) * variables.Get(i - 1);
+    // Оба массива смежные: проход по указателям без виртуальных Get и проверок индекса
+    const T* coefficient = coefficients.begin();
+    T result = *coefficient++;
+    for (const T& variable : variables) {
+        result += *coefficient++ * variable;
     }
     return result;
 }
 
 template <class T> 
 T LinearForm<T>::Evaluate(T x) const {
-    T result = Get(0);
-    T x_power = x;
-    for (int i = 1; i < GetLength(); ++i) {
-        result += Get(i) * x_power;
-        x_power *= x;
+    if (GetLength() == 0) throw std::out_of_range("Form is empty");
+    const T* coefficient = coefficients.end() - 1;
+    T result = *coefficient;
+    while (coefficient != coefficients.begin()) {
+        result = result * x + *--coefficient;
     }
     return result;
 }
 
+template <class T> 
+T LinearForm<T>::EvaluateEstrin(T x) const {
+    if (GetLength() == 0) throw std::out_of_range("Form is empty");
+    const T* c = coefficients.begin();
+    int blocks = GetLength() / 8;
+
+    // Старшие коэффициенты, не набравшие целого блока, - по Горнеру
+    T result = T(0);
+    for (int k = GetLength() - 1; k >= blocks * 8; --k) {
+        result = result * x + c[k];
+    }
+
+    T x2 = x * x;
+    T x4 = x2 * x2;
+    T x8 = x4 * x4;
+    for (int b = blocks - 1; b >= 0; --b) {
+        const T* block = c + b * 8;
+        T low = (block[0] + block[1] * x) + (block[2] + block[3] * x) * x2;
+        T high = (block[4] + block[5] * x) + (block[6] + block[7] * x) * x2;
+        result = result * x8 + (low + high * x4);
+    }
+    return result;
+}
+
+template <class T> 
+ArraySequence<T>* LinearForm<T>::EvaluateMany(const T* xs, int count) const {
+    if (GetLength() == 0) throw std::out_of_range("Form is empty");
+    if (count < 0) throw std::invalid_argument("Invalid batch size");
+    DynamicArray<T> values(count);
+    SimdKernels<T>::Horner(coefficients.begin(), GetLength(), xs, values.Data(), count);
+    return new MutableArraySequence<T>(std::move(values));
+}
+
+template <class T> 
+ArraySequence<T>* LinearForm<T>::EvaluateBatch(const T* points, int count, MatrixLayout layout, int threads) const {
+    return EvaluateBatch(this, 1, points, count, layout, threads);
+}
+
+template <class T> 
+ArraySequence<T>* LinearForm<T>::EvaluateBatch(const LinearForm<T>* forms, int formCount, const T* points, int count,
+                                               MatrixLayout layout, int threads) {
+    if (formCount <= 0 || count < 0) {
+        throw std::invalid_argument("Invalid batch size");
+    }
+    if (forms[0].GetLength() == 0) {
+        throw std::invalid_argument("Form is empty");
+    }
+
+    DynamicArray<BatchForm<T>> batch(0);
+    batch.Reserve(formCount);
+    for (int f = 0; f < formCount; ++f) {
+        forms[0].CheckDimensions(forms[f]);
+        const T* coefficient = forms[f].coefficients.begin();
+        batch.EmplaceBack(BatchForm<T>{ coefficient[0], coefficient + 1 });
+    }
+
+    DynamicArray<T> values(count * formCount);
+    BatchEvaluator<T>::Evaluate(batch.Data(), formCount, forms[0].GetLength() - 1,
+                                points, count, layout, values.Data(), threads);
+    return new MutableArraySequence<T>(std::move(values));
+}
+
 template <class T> 
 ArraySequence<T>* LinearForm<T>::Gradient() const {              
     if (GetLength() <= 1) {
         return new MutableArraySequence<T>(); 
     }
     
-    T* grad_coeffs = new T[GetLength() - 1];
-    for (int i = 1; i < GetLength(); ++i) {
-        grad_coeffs[i - 1] = Get(i);
+    DynamicArray<T> grad_coeffs(0);
+    grad_coeffs.Reserve(GetLength() - 1);
+    for (const T* coefficient = coefficients.begin() + 1; coefficient != coefficients.end(); ++coefficient) {
+        grad_coeffs.EmplaceBack(*coefficient);
     }
-    
-    ArraySequence<T>* result = new MutableArraySequence<T>(grad_coeffs, GetLength() - 1);
-    delete[] grad_coeffs;
-    return result;
+    return new MutableArraySequence<T>(std::move(grad_coeffs));
 }
 
 template <class T> 
@@ -1,12 +1,20 @@
 #ifndef STACK_H
 #define STACK_H
 
+#include <iostream>
+#include <iterator>
+#include <vector>
 #include "1_ArraySequence.h"
+#include "43_StackPipeline.h"
+#include "44_ParallelChunks.h"
 
+// Элементы лежат в DynamicArray, вершина - последний элемент. Ёмкость растёт
+// геометрически и при Pop не уменьшается, поэтому Push и Pop - O(1) амортизированно.
+// Копия стека делит буфер с оригиналом до первого изменения (copy-on-write)
 template <class T>
 class Stack {
 private:
-   MutableArraySequence<T>* buffer;
+   DynamicArray<T> items;
 
 public:
     
@@ -23,55 +31,78 @@ public:
     T Pop();
     T Peek() const;
 
+    // Пачкой: место под count элементов выделяется один раз
+    void PushMany(const T* values, int count);
+    // Снимает count верхних элементов; если out задан, пишет их туда в порядке снятия
+    void PopMany(int count, T* out = nullptr);
+    void Reserve(int capacity);
+
     
-    Stack<T>* Map(T (*f)(T)) const;
-    Stack<T>* Where(bool (*f)(T)) const;
-    T Reduce(T (*f)(T, T), T initial) const;
+    // f - любой вызываемый объект: указатель на функцию, лямбда, функтор
+    template <class F> Stack<T>* Map(F f) const;
+    template <class P> Stack<T>* Where(P f) const;
+    template <class F> T Reduce(F f, T initial) const;
+
+    // Ленивая цепочка: s.Pipeline().Map(f).Where(g).Reduce(h, 0) - один проход без промежуточных стеков
+    StackPipeline<RangeStage<T>> Pipeline() const {
+        return StackPipeline<RangeStage<T>>(RangeStage<T>{ items.begin(), items.end() });
+    }
+
+    // Параллельно для больших стеков: куски по grain элементов в threads потоках (0 - по числу ядер),
+    // результаты кусков собираются по порядку. f вызывается из нескольких потоков одновременно.
+    // Для ParallelReduce f должна быть ассоциативной: f(a, f(b, c)) == f(f(a, b), c)
+    template <class F> Stack<T>* ParallelMap(F f, int grain = PARALLEL_GRAIN, int threads = 0) const;
+    template <class P> Stack<T>* ParallelWhere(P f, int grain = PARALLEL_GRAIN, int threads = 0) const;
+    template <class F> T ParallelReduce(F f, T initial, int grain = PARALLEL_GRAIN, int threads = 0) const;
 
     
     Stack<T>* Concat(const Stack<T>& other) const;
     Stack<T>* GetSubsequence(int startIndex, int endIndex) const;
-    bool ContainsSubsequence(const T* items, int count) const;
+    bool ContainsSubsequence(const T* pattern, int count) const;
 
    
     void Print() const;
 
 private:
+    template <class Stage> friend class StackPipeline;
+
+    explicit Stack(DynamicArray<T>&& values);
     void ValidateIndex(int index) const;
 };
 
 
 
 template <class T>
-Stack<T>::Stack() : buffer(new MutableArraySequence<T>()) {}
+Stack<T>::Stack() : items(0) {}
 
 template <class T>
-Stack<T>::Stack(T* items, int count) : buffer(new MutableArraySequence<T>(items, count)) {}
+Stack<T>::Stack(T* values, int count) : items(values, count) {}
 
 template <class T>
-Stack<T>::Stack(const Stack<T>& other) : buffer(new MutableArraySequence<T>(*other.buffer)) {}
+Stack<T>::Stack(const Stack<T>& other) : items(other.items) {}
 
 template <class T>
-Stack<T>::Stack(const MutableArraySequence<T>& seq) : buffer(new MutableArraySequence<T>(seq)) {}
+Stack<T>::Stack(const MutableArraySequence<T>& seq) : items(seq.begin(), seq.end()) {}
 
 template <class T>
-Stack<T>::~Stack() {
-    delete buffer;
-}
+Stack<T>::Stack(DynamicArray<T>&& values) : items(std::move(values)) {}
+
+template <class T>
+Stack<T>::~Stack() {}
 
 template <class T>
 int Stack<T>::GetLength() const {
-    return buffer->GetLength();
+    return items.GetSize();
 }
 
 template <class T>
 bool Stack<T>::IsEmpty() const {
-    return buffer->GetLength() == 0;
+    return items.GetSize() == 0;
 }
 
 template <class T>
 void Stack<T>::Push(T item) {
-    buffer->Append(item);
+    items.EmplaceBack(std::move(item));
 }
 
 template <class T>
@@ -79,11 +110,8 @@ T Stack<T>::Pop() {
     if (IsEmpty()) {
         throw std::out_of_range("Stack is empty");
     }
-    T item = buffer->GetLast();
-    
-    auto newBuffer = buffer->GetSubsequence(0, buffer->GetLength() - 2);
-    delete buffer;
-    buffer = dynamic_cast<MutableArraySequence<T>*>(newBuffer);
+    T item = std::move(items.Data()[items.GetSize() - 1]);
+    items.Resize(items.GetSize() - 1);
     return item;
 }
 
@@ -92,50 +120,117 @@ T Stack<T>::Peek() const {
     if (IsEmpty()) {
         throw std::out_of_range("Stack is empty");
     }
-    return buffer->GetLast();
+    return items.Data()[items.GetSize() - 1];
 }
 
 template <class T>
-Stack<T>* Stack<T>::Map(T (*f)(T)) const {
-    MutableArraySequence<T>* newBuffer = new MutableArraySequence<T>();
-    for (int i = 0; i < buffer->GetLength(); ++i) {
-        newBuffer->Append(f(buffer->Get(i)));
+void Stack<T>::PushMany(const T* values, int count) {
+    if (count < 0) {
+        throw std::invalid_argument("Negative count");
     }
-    return new Stack<T>(*newBuffer);  
+    items.AppendRange(values, values + count);
 }
 
 template <class T>
-Stack<T>* Stack<T>::Where(bool (*f)(T)) const {
-    MutableArraySequence<T>* newBuffer = new MutableArraySequence<T>();
-    for (int i = 0; i < buffer->GetLength(); ++i) {
-        T item = buffer->Get(i);
-        if (f(item)) {
-            newBuffer->Append(item);
+void Stack<T>::PopMany(int count, T* out) {
+    if (count < 0 || count > GetLength()) {
+        throw std::out_of_range("Not enough elements in stack");
+    }
+    if (out != nullptr) {
+        T* top = items.Data() + items.GetSize() - 1;
+        for (int i = 0; i < count; ++i) {
+            out[i] = std::move(*(top - i));
         }
     }
-    return new Stack<T>(*newBuffer);  
+    items.Resize(items.GetSize() - count);
 }
 
 template <class T>
-T Stack<T>::Reduce(T (*f)(T, T), T initial) const {
-    if (IsEmpty()) {
-        return initial;
+void Stack<T>::Reserve(int capacity) {
+    items.Reserve(capacity);
+}
+
+template <class T>
+template <class F>
+Stack<T>* Stack<T>::Map(F f) const {
+    // Результат f приводится к T: Map стека не меняет тип элементов
+    return Pipeline().Map([&f](const T& item) -> T { return f(item); }).ToStack();
+}
+
+template <class T>
+template <class P>
+Stack<T>* Stack<T>::Where(P f) const {
+    return Pipeline().Where(f).ToStack();
+}
+
+template <class T>
+template <class F>
+T Stack<T>::Reduce(F f, T initial) const {
+    return Pipeline().Reduce(f, std::move(initial));
+}
+
+template <class T>
+template <class F>
+Stack<T>* Stack<T>::ParallelMap(F f, int grain, int threads) const {
+    const T* data = items.Data();
+    std::vector<std::vector<T>> parts = ParallelCollect<T>(GetLength(), grain, threads,
+        [data, &f](std::vector<T>& part, int begin, int end) {
+            part.reserve(end - begin);
+            for (int i = begin; i < end; ++i) {
+                part.emplace_back(f(data[i]));
+            }
+        });
+    DynamicArray<T> newItems(0);
+    newItems.Reserve(GetLength());
+    for (std::vector<T>& part : parts) {
+        newItems.AppendRange(std::make_move_iterator(part.begin()), std::make_move_iterator(part.end()));
     }
-    
-    T result = f(buffer->Get(0), initial);
-    for (int i = 1; i < buffer->GetLength(); ++i) {
-        result = f(buffer->Get(i), result);
+    return new Stack<T>(std::move(newItems));
+}
+
+template <class T>
+template <class P>
+Stack<T>* Stack<T>::ParallelWhere(P f, int grain, int threads) const {
+    const T* data = items.Data();
+    std::vector<std::vector<T>> parts = ParallelCollect<T>(GetLength(), grain, threads,
+        [data, &f](std::vector<T>& part, int begin, int end) {
+            for (int i = begin; i < end; ++i) {
+                if (f(data[i])) {
+                    part.push_back(data[i]);
+                }
+            }
+        });
+    DynamicArray<T> newItems(0);
+    for (std::vector<T>& part : parts) {
+        newItems.AppendRange(std::make_move_iterator(part.begin()), std::make_move_iterator(part.end()));
     }
-    return result;
+    return new Stack<T>(std::move(newItems));
+}
+
+// Кусок сворачивается начиная со своего первого элемента, затем куски присоединяются к initial:
+// f(p2, f(p1, initial)) по ассоциативности равно последовательному Reduce
+template <class T>
+template <class F>
+T Stack<T>::ParallelReduce(F f, T initial, int grain, int threads) const {
+    const T* data = items.Data();
+    return ParallelFold(GetLength(), grain, threads, std::move(initial),
+        [data, &f](int begin, int end) {
+            T partial = data[begin];
+            for (int i = begin + 1; i < end; ++i) {
+                partial = f(data[i], partial);
+            }
+            return partial;
+        },
+        [&f](T result, const T& partial) { return f(partial, result); });
 }
 
 template <class T>
 Stack<T>* Stack<T>::Concat(const Stack<T>& other) const {
-   MutableArraySequence<T>* newBuffer = new MutableArraySequence<T>(*buffer);
-    for (int i = 0; i < other.buffer->GetLength(); ++i) {
-        newBuffer->Append(other.buffer->Get(i));
-    }
-    return new Stack<T>(*newBuffer);
+    DynamicArray<T> newItems(0);
+    newItems.Reserve(GetLength() + other.GetLength());
+    newItems.AppendRange(items.begin(), items.end());
+    newItems.AppendRange(other.items.begin(), other.items.end());
+    return new Stack<T>(std::move(newItems));
 }
 
 template <class T>
@@ -146,21 +241,20 @@ Stack<T>* Stack<T>::GetSubsequence(int startIndex, int endIndex) const {
         throw std::invalid_argument("Start index > end index");
     }
     
-    MutableArraySequence<T>* subBuffer = dynamic_cast<MutableArraySequence<T>*>(buffer->GetSubsequence(startIndex, endIndex));
-    Stack<T>* result = new Stack<T>(*subBuffer);
-    delete subBuffer;
-    return result;
+    ValidateIndex(endIndex);
+    return new Stack<T>(DynamicArray<T>(items.begin() + startIndex, items.begin() + endIndex + 1));
 }
 
 template <class T>
-bool Stack<T>::ContainsSubsequence(const T* items, int count) const {
+bool Stack<T>::ContainsSubsequence(const T* pattern, int count) const {
     if (count == 0) return true;
-    if (count > buffer->GetLength()) return false;
+    if (count > GetLength()) return false;
     
-    for (int i = 0; i <= buffer->GetLength() - count; ++i) {
+    const T* data = items.begin();
+    for (int i = 0; i <= GetLength() - count; ++i) {
         bool match = true;
         for (int j = 0; j < count; ++j) {
-            if (buffer->Get(i + j) != items[j]) {
+            if (data[i + j] != pattern[j]) {
                 match = false;
                 break;
             }
@@ -173,15 +267,15 @@ bool Stack<T>::ContainsSubsequence(const T* items, int count) const {
 template <class T>
 void Stack<T>::Print() const {
     std::cout << "[ ";
-    for (int i = 0; i < buffer->GetLength(); ++i) {
-        std::cout << buffer->Get(i) << " ";
+    for (const T& item : items) {
+        std::cout << item << " ";
     }
     std::cout << "]" << std::endl;
 }
 
 template <class T>
 void Stack<T>::ValidateIndex(int index) const {
-    if (index < 0 || index >= buffer->GetLength()) {
+    if (index < 0 || index >= GetLength()) {
         throw std::out_of_range("Index out of range");
     }
 }
@@ -5,20 +5,38 @@
 #include <stdexcept>
 #include <functional>
 #include <memory>
+#include "19_MemoryResource.h"
+#include "44_ParallelChunks.h"
 
 template <typename T>
 class SegmentedDeque {
 private:
     static constexpr int SEGMENT_SIZE = 16;
-    std::vector<std::unique_ptr<std::vector<T>>> segments;
+
+    typedef std::vector<T, ResourceAllocator<T>> Segment;
+
+    struct SegmentDeleter {
+        MemoryResource* resource;
+        void operator()(Segment* segment) const { DeleteObject(resource, segment); }
+    };
+
+    typedef std::unique_ptr<Segment, SegmentDeleter> SegmentPtr;
+
+    MemoryResource* resource;
+    std::vector<SegmentPtr, ResourceAllocator<SegmentPtr>> segments;
     int front_segment = 0;
     int front_offset = 0;
     int back_segment = 0;
     int back_offset = 0;
     int total_size = 0;
 
+    SegmentPtr make_segment() {
+        Segment* segment = NewObject<Segment>(resource, SEGMENT_SIZE, T(), ResourceAllocator<T>(resource));
+        return SegmentPtr(segment, SegmentDeleter{resource});
+    }
+
     void allocate_segment() {
-        segments.emplace_back(std::make_unique<std::vector<T>>(SEGMENT_SIZE));
+        segments.emplace_back(make_segment());
     }
 
     void deallocate_unused_segments() {
@@ -29,13 +47,28 @@ private:
         }
     }
 
+    // Буферы кусков одной последовательностью; деку наполняет только вызывающий поток,
+    // так что ресурс памяти не обязан быть потокобезопасным
+    template <typename U>
+    static SegmentedDeque<U> collect(const std::vector<std::vector<U>>& parts, MemoryResource* resource) {
+        SegmentedDeque<U> result(resource);
+        for (const std::vector<U>& part : parts) {
+            for (const U& value : part) {
+                result.push_back(value);
+            }
+        }
+        return result;
+    }
+
 public:
-    SegmentedDeque() {
+    explicit SegmentedDeque(MemoryResource* resource = DefaultResource())
+        : resource(resource), segments(ResourceAllocator<SegmentPtr>(resource)) {
         allocate_segment();
     }
 
     SegmentedDeque(SegmentedDeque&& other) noexcept
-        : segments(std::move(other.segments)),
+        : resource(other.resource),
+          segments(std::move(other.segments)),
           front_segment(other.front_segment),
           front_offset(other.front_offset),
           back_segment(other.back_segment),
@@ -50,6 +83,7 @@ public:
 
     SegmentedDeque& operator=(SegmentedDeque&& other) noexcept {
         if (this != &other) {
+            resource = other.resource;
             segments = std::move(other.segments);
             front_segment = other.front_segment;
             front_offset = other.front_offset;
@@ -79,7 +113,7 @@ public:
     void push_front(const T& value) {
         if (front_offset == 0) {
             if (front_segment == 0) {
-                segments.insert(segments.begin(), std::make_unique<std::vector<T>>(SEGMENT_SIZE)); //сегмент -1
+                segments.insert(segments.begin(), make_segment()); //сегмент -1
                 back_segment++;
             } else {
                 front_segment--;
@@ -125,12 +159,24 @@ public:
         return (*segments[segment])[offset];
     }
 
+    const T& operator[](int index) const {
+        if (index < 0 || index >= total_size) {
+            throw std::out_of_range("Index out of range");
+        }
+        index += front_offset;
+        int segment = front_segment + index / SEGMENT_SIZE;
+        int offset = index % SEGMENT_SIZE;
+        return (*segments[segment])[offset];
+    }
+
+    MemoryResource* get_resource() const { return resource; }
+
     int size() const { return total_size; }
     bool empty() const { return total_size == 0; }
 
     template <typename U>
     SegmentedDeque<U> map(std::function<U(const T&)> func) const {
-        SegmentedDeque<U> result;
+        SegmentedDeque<U> result(resource);
         for (int i = 0; i < size(); ++i) {
             result.push_back(func((*this)[i]));
         }
@@ -138,7 +184,7 @@ public:
     }
 
     SegmentedDeque<T> where(std::function<bool(const T&)> predicate) const {
-        SegmentedDeque<T> result;
+        SegmentedDeque<T> result(resource);
         for (int i = 0; i < size(); ++i) {
             if (predicate((*this)[i])) {
                 result.push_back((*this)[i]);
@@ -156,8 +202,50 @@ public:
         return result;
     }
 
+    // Параллельные варианты: куски по grain элементов в threads потоках (0 - по числу ядер),
+    // результаты кусков собираются по порядку. func вызывается из нескольких потоков.
+    // Для parallel_reduce func должна быть ассоциативной: func(func(a, b), c) == func(a, func(b, c))
+    template <typename U>
+    SegmentedDeque<U> parallel_map(std::function<U(const T&)> func, int grain = PARALLEL_GRAIN, int threads = 0) const {
+        std::vector<std::vector<U>> parts = ParallelCollect<U>(size(), grain, threads,
+            [this, &func](std::vector<U>& part, int begin, int end) {
+                part.reserve(end - begin);
+                for (int i = begin; i < end; ++i) {
+                    part.push_back(func((*this)[i]));
+                }
+            });
+        return collect(parts, resource);
+    }
+
+    SegmentedDeque<T> parallel_where(std::function<bool(const T&)> predicate, int grain = PARALLEL_GRAIN,
+                                     int threads = 0) const {
+        std::vector<std::vector<T>> parts = ParallelCollect<T>(size(), grain, threads,
+            [this, &predicate](std::vector<T>& part, int begin, int end) {
+                for (int i = begin; i < end; ++i) {
+                    if (predicate((*this)[i])) {
+                        part.push_back((*this)[i]);
+                    }
+                }
+            });
+        return collect(parts, resource);
+    }
+
+    // Кусок сворачивается начиная со своего первого элемента, затем куски присоединяются к initial
+    T parallel_reduce(std::function<T(T, const T&)> func, T initial, int grain = PARALLEL_GRAIN,
+                      int threads = 0) const {
+        return ParallelFold(size(), grain, threads, std::move(initial),
+            [this, &func](int begin, int end) {
+                T partial = (*this)[begin];
+                for (int i = begin + 1; i < end; ++i) {
+                    partial = func(std::move(partial), (*this)[i]);
+                }
+                return partial;
+            },
+            [&func](T result, const T& partial) { return func(std::move(result), partial); });
+    }
+
     SegmentedDeque<T> concat(const SegmentedDeque<T>& other) const {
-        SegmentedDeque<T> result;
+        SegmentedDeque<T> result(resource);
         
         for (int i = 0; i < size(); ++i) {
             result.push_back((*this)[i]);
@@ -173,7 +261,7 @@ public:
         if (start < 0 || end >= size() || start > end) {
             throw std::out_of_range("Invalid subsequence range");
         }
-        SegmentedDeque<T> result;
+        SegmentedDeque<T> result(resource);
         for (int i = start; i <= end; ++i) {
             result.push_back((*this)[i]);
         }
@@ -9,6 +9,7 @@
 #include <sstream>
 #include <unordered_map>
 #include <iostream>       
+#include "19_MemoryResource.h"
 
 template <typename T>
 class BinaryTree {
@@ -22,6 +23,9 @@ private:
     };
 
     Node* root;
+    MemoryResource* resource;
+
+    template <typename U> friend class BinaryTree;
 
     Node* copyTree(Node* node) const;
     void clearTree(Node* node);
@@ -52,7 +56,7 @@ private:
     Node* deserializePKL(std::stringstream& ss);
 
 public:
-    BinaryTree();
+    explicit BinaryTree(MemoryResource* resource = DefaultResource());
     BinaryTree(const BinaryTree& other);
     BinaryTree(BinaryTree&& other) noexcept;
     ~BinaryTree();
@@ -103,15 +107,15 @@ public:
 
 
 template <typename T>
-BinaryTree<T>::BinaryTree() : root(nullptr) {}
+BinaryTree<T>::BinaryTree(MemoryResource* resource) : root(nullptr), resource(resource) {}
 
 template <typename T>
-BinaryTree<T>::BinaryTree(const BinaryTree& other) {
+BinaryTree<T>::BinaryTree(const BinaryTree& other) : resource(other.resource) {
     root = copyTree(other.root);
 }
 
 template <typename T>
-BinaryTree<T>::BinaryTree(BinaryTree&& other) noexcept : root(other.root) {
+BinaryTree<T>::BinaryTree(BinaryTree&& other) noexcept : root(other.root), resource(other.resource) {
     other.root = nullptr;
 }
 
@@ -123,7 +127,7 @@ BinaryTree<T>::~BinaryTree() {
 template <typename T>
 typename BinaryTree<T>::Node* BinaryTree<T>::copyTree(Node* node) const {
     if (!node) return nullptr;
-    Node* newNode = new Node(node->data);
+    Node* newNode = NewObject<Node>(resource, node->data);
     newNode->left = copyTree(node->left);
     newNode->right = copyTree(node->right);
     return newNode;
@@ -134,14 +138,14 @@ void BinaryTree<T>::clearTree(Node* node) {
     if (node) {
         clearTree(node->left);
         clearTree(node->right);
-        delete node;
+        DeleteObject(resource, node);
     }
 }
 
 template <typename T>
 void BinaryTree<T>::insert(const T& value) {
     if (!root) {
-        root = new Node(value);
+        root = NewObject<Node>(resource, value);
         return;
     }
 
@@ -153,14 +157,14 @@ void BinaryTree<T>::insert(const T& value) {
         q.pop();
 
         if (!current->left) {
-            current->left = new Node(value);
+            current->left = NewObject<Node>(resource, value);
             return;
         } else {
             q.push(current->left);
         }
 
         if (!current->right) {
-            current->right = new Node(value);
+            current->right = NewObject<Node>(resource, value);
             return;
         } else {
             q.push(current->right);
@@ -189,7 +193,7 @@ void BinaryTree<T>::remove(const T& value) {
     if (!root) return;
     
     if (root->data == value && !root->left && !root->right) {
-        delete root;
+        DeleteObject(resource, root);
         root = nullptr;
         return;
     }
@@ -238,7 +242,7 @@ void BinaryTree<T>::remove(const T& value) {
             parent->right = nullptr;
         }
     }
-    delete deepest;
+    DeleteObject(resource, deepest);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -332,13 +336,13 @@ BinaryTree<U>* BinaryTree<T>::map(U (*func)(T)) const {
 template <typename T>
 template <typename U>
 BinaryTree<U>* BinaryTree<T>::map(const std::function<U(T)>& func) const {
-    auto* newTree = new BinaryTree<U>();
+    auto* newTree = new BinaryTree<U>(resource);
     if (!root) return newTree;
     
     std::queue<Node*> q;
     std::queue<typename BinaryTree<U>::Node*> newQ;
     q.push(root);
-    newTree->root = new typename BinaryTree<U>::Node(func(root->data));
+    newTree->root = NewObject<typename BinaryTree<U>::Node>(resource, func(root->data));
     newQ.push(newTree->root);
     
     while (!q.empty()) {
@@ -348,13 +352,13 @@ BinaryTree<U>* BinaryTree<T>::map(const std::function<U(T)>& func) const {
         newQ.pop();
         
         if (current->left) {
-            newCurrent->left = new typename BinaryTree<U>::Node(func(current->left->data));
+            newCurrent->left = NewObject<typename BinaryTree<U>::Node>(resource, func(current->left->data));
             q.push(current->left);
             newQ.push(newCurrent->left);
         }
         
         if (current->right) {
-            newCurrent->right = new typename BinaryTree<U>::Node(func(current->right->data));
+            newCurrent->right = NewObject<typename BinaryTree<U>::Node>(resource, func(current->right->data));
             q.push(current->right);
             newQ.push(newCurrent->right);
         }
@@ -370,7 +374,7 @@ BinaryTree<T>* BinaryTree<T>::where(bool (*predicate)(T)) const {
 
 template <typename T>
 BinaryTree<T>* BinaryTree<T>::where(const std::function<bool(T)>& predicate) const {
-    auto* newTree = new BinaryTree<T>();
+    auto* newTree = new BinaryTree<T>(resource);
     if (!root) return newTree;
     
     std::queue<Node*> q;
@@ -422,7 +426,7 @@ BinaryTree<T>* BinaryTree<T>::extractSubtree(const T& value) const {
     Node* subtreeRoot = findNode(root, value);
     if (!subtreeRoot) return nullptr;
     
-    auto* subtree = new BinaryTree<T>();
+    auto* subtree = new BinaryTree<T>(resource);
     subtree->root = extractSubtree(subtreeRoot);
     return subtree;
 }
@@ -430,7 +434,7 @@ BinaryTree<T>* BinaryTree<T>::extractSubtree(const T& value) const {
 template <typename T>
 typename BinaryTree<T>::Node* BinaryTree<T>::extractSubtree(Node* node) const {
     if (!node) return nullptr;
-    Node* newNode = new Node(node->data);
+    Node* newNode = NewObject<Node>(resource, node->data);
     newNode->left = extractSubtree(node->left);
     newNode->right = extractSubtree(node->right);
     return newNode;
@@ -576,7 +580,7 @@ typename BinaryTree<T>::Node* BinaryTree<T>::deserializeKLP(std::stringstream& s
     T value;
     converter >> value;
     
-    Node* node = new Node(value);
+    Node* node = NewObject<Node>(resource, value);
     node->left = deserializeKLP(ss);
     node->right = deserializeKLP(ss);
     return node;
@@ -591,7 +595,7 @@ typename BinaryTree<T>::Node* BinaryTree<T>::deserializeKPL(std::stringstream& s
     T value;
     converter >> value;
     
-    Node* node = new Node(value);
+    Node* node = NewObject<Node>(resource, value);
     node->right = deserializeKPL(ss);
     node->left = deserializeKPL(ss);
     return node;
@@ -610,7 +614,7 @@ typename BinaryTree<T>::Node* BinaryTree<T>::deserializeLPK(std::stringstream& s
     T value;
     converter >> value;
     
-    Node* node = new Node(value);
+    Node* node = NewObject<Node>(resource, value);
     node->left = left;
     node->right = right;
     return node;
@@ -628,7 +632,7 @@ typename BinaryTree<T>::Node* BinaryTree<T>::deserializeLKP(std::stringstream& s
     T value;
     converter >> value;
     
-    Node* node = new Node(value);
+    Node* node = NewObject<Node>(resource, value);
     node->left = left;
     node->right = deserializeLKP(ss);
     return node;
@@ -647,7 +651,7 @@ typename BinaryTree<T>::Node* BinaryTree<T>::deserializePLK(std::stringstream& s
     T value;
     converter >> value;
     
-    Node* node = new Node(value);
+    Node* node = NewObject<Node>(resource, value);
     node->left = left;
     node->right = right;
     return node;
@@ -665,7 +669,7 @@ typename BinaryTree<T>::Node* BinaryTree<T>::deserializePKL(std::stringstream& s
     T value;
     converter >> value;
     
-    Node* node = new Node(value);
+    Node* node = NewObject<Node>(resource, value);
     node->right = right;
     node->left = deserializePKL(ss);
     return node;
@@ -684,18 +688,18 @@ void BinaryTree<T>::deserializeFromParentList(const std::string& str) {
     
     while (ss >> child >> parent >> type) {
         if (!root && type == 'R') {
-            root = new Node(parent);
+            root = NewObject<Node>(resource, parent);
             nodes[parent] = root;
         }
         
         Node* parentNode = nodes[parent];
         if (!parentNode) {
-            parentNode = new Node(parent);
+            parentNode = NewObject<Node>(resource, parent);
             nodes[parent] = parentNode;
             if (!root) root = parentNode;
         }
         
-        Node* childNode = new Node(child);
+        Node* childNode = NewObject<Node>(resource, child);
         nodes[child] = childNode;
         
         if (type == 'L') parentNode->left = childNode;
@@ -766,6 +770,7 @@ BinaryTree<T>& BinaryTree<T>::operator=(BinaryTree&& other) noexcept {
     if (this != &other) {
         clearTree(root);
         root = other.root;
+        resource = other.resource;
         other.root = nullptr;
     }
     return *this;
@@ -3,6 +3,19 @@
 #include "13_TestsSegmentedDeque.h"
 #include "14_TestsBinaryTree.h"
 #include "15_TestsSkipList.h"
+#include "17_TestsDynamicArray.h"
+#include "18_Benchmarks.h"
+#include "20_TestsMemoryResource.h"
+#include "22_TestsUnrolledList.h"
+#include "24_TestsDoublyLinkedList.h"
+#include "25_TestsLinkedList.h"
+#include "26_TestsIterators.h"
+#include "28_TestsPersistentVector.h"
+#include "30_TestsPersistentList.h"
+#include "32_TestsSequenceView.h"
+#include "34_TestsStaticSequence.h"
+#include "39_TestsSparseLinearForm.h"
+#include "41_TestsConcurrentStack.h"
 #include <iostream>
 #include <windows.h>
 
@@ -15,6 +28,10 @@ int main() {
     TestEvaluation();
     TestGradient();
     TestEdgeCases();
+    TestKernels();
+    TestBatchEvaluation();
+    TestPolynomialEvaluation();
+    TestExpressions();
     RunFileTests();
     
     std::cout << "BinaryTree tests...\n\n";
@@ -29,5 +46,44 @@ int main() {
     std::cout << "Stack tests...\n\n";
     testStack();
 
+    std::cout << "DynamicArray tests...\n\n";
+    testDynamicArray();
+
+    std::cout << "MemoryResource tests...\n\n";
+    testMemoryResource();
+
+    std::cout << "UnrolledLinkedList tests...\n\n";
+    testUnrolledList();
+
+    std::cout << "DoublyLinkedList tests...\n\n";
+    testDoublyLinkedList();
+
+    std::cout << "LinkedList tests...\n\n";
+    testLinkedList();
+
+    std::cout << "Iterator tests...\n\n";
+    testIterators();
+
+    std::cout << "PersistentVector tests...\n\n";
+    testPersistentVector();
+
+    std::cout << "PersistentList tests...\n\n";
+    testPersistentList();
+
+    std::cout << "SequenceView tests...\n\n";
+    testSequenceView();
+
+    std::cout << "StaticSequence tests...\n\n";
+    testStaticSequence();
+
+    std::cout << "SparseLinearForm tests...\n\n";
+    testSparseLinearForm();
+
+    std::cout << "ConcurrentStack tests...\n\n";
+    testConcurrentStack();
+
+    std::cout << "Benchmarks...\n\n";
+    runBenchmarks();
+
     return 0;
 }
\ No newline at end of file